@@ -0,0 +1,45 @@
+#ifndef ASSEMBLER_BENCH_SOURCE_H
+#define ASSEMBLER_BENCH_SOURCE_H
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+//synthetic program of roughly size bytes, a mix of every token type the lexer knows
+inline std::string generated_source(std::size_t size) {
+    std::string source = ".data\ncounter: .word 5, 0x10, 0b101, -3\nmsg: .string \"benchmark\"\n"
+                         ".bss\nbuf: .word 0\n.text\n.global main\nmain: addi s0, zero, 10\n";
+
+    char block[256];
+    for (int i = 0; source.size() < size; i++) {
+        const int length = std::snprintf(block, sizeof(block),
+                                         "loop%d: addi s0, s0, -1\n"
+                                         "    add s1, s0, s0\n"
+                                         "    lw t0, counter\n"
+                                         "    sw s1, buf\n"
+                                         "    set t1, 0x1234\n"
+                                         "    bne s0, zero, loop%d\n",
+                                         i, i);
+        source.append(block, length);
+    }
+
+    return source;
+}
+
+//size of the source the benchmarks read, large enough that it doesn't fit in cache
+inline constexpr std::size_t bench_source_size = 16 << 20;
+
+//writes the generated source to a file in the temp directory once, returns its path
+inline const std::filesystem::path &generated_source_file() {
+    static const std::filesystem::path path = [] {
+        auto file_path = std::filesystem::temp_directory_path() / "assembler_bench_source.s";
+        std::ofstream(file_path, std::ios::binary) << generated_source(bench_source_size);
+        return file_path;
+    }();
+
+    return path;
+}
+
+#endif//ASSEMBLER_BENCH_SOURCE_H
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "bench_source.h"
+#include "binary_generator.h"
+#include "disassembly.h"
+#include "elf_image.h"
+#include "program_options.h"
+#include "semantic_analyzer.h"
+#include "syntax.h"
+
+//.text only program of roughly size bytes, with labels, branches and relocations
+static std::string text_source(std::size_t size) {
+    std::string source = ".data\ncounter: .word 5\n.bss\nbuf: .word 0\n"
+                         ".text\n.global main\nmain: addi s0, zero, 10\n";
+
+    char block[256];
+    for (int i = 0; source.size() < size; i++) {
+        const int length = std::snprintf(block, sizeof(block),
+                                         "loop%d: addi s0, s0, -1\n"
+                                         "    add s1, s0, s0\n"
+                                         "    lw t0, counter\n"
+                                         "    sw s1, buf\n"
+                                         "    set t1, 0x1234\n"
+                                         "    bne s0, zero, loop%d\n",
+                                         i, i);
+        source.append(block, length);
+    }
+
+    return source;
+}
+
+//assembled once into the temp directory, the way main does without preprocessing
+static const std::filesystem::path &assembled_file() {
+    static const std::filesystem::path path = [] {
+        auto file_path = std::filesystem::temp_directory_path() / "assembler_bench_disasm.elf";
+        std::vector<std::string> arguments = {"assembler", "bench.s", "-o", file_path.string()};
+        std::vector<char *> argv;
+        for (auto &argument: arguments) argv.push_back(argument.data());
+
+        const std::string source = text_source(bench_source_size);
+        program_options options(argv.size(), argv.data());
+        syntax parser(source, options.lexer);
+        auto compile_unit = semantic_analyzer(parser, options);
+        binary_generator(file_path.string(), compile_unit);
+        return file_path;
+    }();
+
+    return path;
+}
+
+//the whole listing written to /dev/null, the argument is the number of threads
+static void BM_disassemble_text(benchmark::State &state) {
+    const auto image = elf_image::map_file(assembled_file());
+    const std::size_t text_size = image.find_section(".text")->sh_size;
+    FILE *output = std::fopen("/dev/null", "w");
+
+    std::size_t listing_size = 0;
+    for (auto _: state) {
+        listing_buffer listing(output);
+        benchmark::DoNotOptimize(disassemble_text(image, listing, state.range(0)));
+        listing.flush();
+        listing_size = listing.size();
+    }
+
+    std::fclose(output);
+    state.SetBytesProcessed(state.iterations() * text_size);
+    state.counters["listing_bytes"] = listing_size;
+}
+
+BENCHMARK(BM_disassemble_text)
+        ->Arg(1)
+        ->Arg(2)
+        ->Arg(4)
+        ->Arg(8)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
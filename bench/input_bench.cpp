@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "bench_source.h"
+#include "lexer.h"
+#include "source_buffer.h"
+
+//lexes the whole source, returns the number of tokens
+static std::size_t lex_all(std::string_view source) {
+    lexer lex(source, lexer_backend::simd);
+    std::size_t ntokens = 0;
+    while (lex.fetch_token().get_type() != lexer::token::types::eof) ntokens++;
+    return ntokens;
+}
+
+//---input paths---//
+//the source is lexed straight out of a read only mapping of the file
+static std::size_t mapped_input(const std::filesystem::path &path) {
+    const auto source = source_buffer::map_file(path);
+    return lex_all(source.view());
+}
+
+//the path the assembler used to take: the file is copied into an open_memstream buffer
+//(the preprocessor output) and read through a stream into the lexer's own buffer
+static std::size_t stream_input(const std::filesystem::path &path) {
+    char *pp_output = nullptr;
+    std::size_t pp_size = 0;
+    FILE *pp_file = open_memstream(&pp_output, &pp_size);
+    FILE *input = std::fopen(path.c_str(), "r");
+
+    char chunk[1 << 16];
+    for (std::size_t nread; (nread = std::fread(chunk, 1, sizeof(chunk), input)) != 0;)
+        std::fwrite(chunk, 1, nread, pp_file);
+    std::fclose(input);
+    std::fclose(pp_file);
+
+    std::istringstream stream(std::string(pp_output, pp_size));
+    std::free(pp_output);
+    std::ostringstream lexer_buffer;
+    lexer_buffer << stream.rdbuf();
+
+    return lex_all(lexer_buffer.view());
+}
+
+//---peak resident set size---//
+//runs the work in a child process so its peak rss isn't hidden by earlier benchmarks
+template<class work_t>
+static long child_peak_rss_kb(work_t work) {
+    const pid_t child = fork();
+    if (child == 0) {
+        work();
+        _exit(0);
+    }
+
+    int status;
+    struct rusage usage;
+    if (child < 0 || wait4(child, &status, 0, &usage) != child) return -1;
+    return usage.ru_maxrss;
+}
+
+//peak rss added by one input path, the child starts out with the pages of the benchmark process
+template<class input_path_t>
+static long peak_rss_kb(input_path_t input_path, const std::filesystem::path &path) {
+    const long baseline = child_peak_rss_kb([] {});
+    return child_peak_rss_kb([&] { input_path(path); }) - baseline;
+}
+
+template<auto input_path>
+static void run_input_path(benchmark::State &state) {
+    const auto &path = generated_source_file();
+
+    //measured once before the first run, freed buffers that malloc keeps resident would hide
+    //the allocations of later children
+    static const long peak_rss = peak_rss_kb(input_path, path);
+
+    std::size_t ntokens = 0;
+    for (auto _: state) benchmark::DoNotOptimize(ntokens = input_path(path));
+
+    state.SetBytesProcessed(state.iterations() * bench_source_size);
+    state.counters["tokens"] = ntokens;
+    state.counters["peak_rss_kb"] = peak_rss;
+}
+
+static void BM_mapped_input(benchmark::State &state) { run_input_path<mapped_input>(state); }
+static void BM_stream_input(benchmark::State &state) { run_input_path<stream_input>(state); }
+
+BENCHMARK(BM_mapped_input)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_stream_input)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,166 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "isa.h"
+
+//random instructions over every inst_id, with random operands
+static const std::vector<isa::instruction> &random_instructions() {
+    static const std::vector<isa::instruction> instructions = [] {
+        std::mt19937 rng(1);
+        std::uniform_int_distribution<int> random_id(0, (int) isa::inst_id::LAST - 1);
+        std::uniform_int_distribution<int> random_reg(0, (int) isa::reg_id::LAST - 1);
+        std::uniform_int_distribution<int32_t> random_imm(-1000, 1000);
+
+        std::vector<isa::instruction> instructions(1 << 20);
+        for (auto &inst: instructions) {
+            inst.id = (isa::inst_id) random_id(rng);
+            inst.format = isa::inst_type_lut[inst.id].format;
+            inst.dr = (isa::reg_id) random_reg(rng);
+            inst.sr1 = (isa::reg_id) random_reg(rng);
+            inst.sr2 = (isa::reg_id) random_reg(rng);
+            inst.immediate = random_imm(rng);
+        }
+
+        return instructions;
+    }();
+
+    return instructions;
+}
+
+//---encoding---//
+static void BM_encode(benchmark::State &state) {
+    const auto &instructions = random_instructions();
+
+    for (auto _: state)
+        for (const auto &inst: instructions) benchmark::DoNotOptimize(inst.encode());
+
+    state.SetItemsProcessed(state.iterations() * instructions.size());
+}
+
+static void BM_encode_many(benchmark::State &state) {
+    const auto &instructions = random_instructions();
+    std::vector<uint8_t> text(instructions.size() * 4);
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(isa::encode_many(instructions, text.data(), 0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * instructions.size());
+}
+
+BENCHMARK(BM_encode)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_encode_many)->Unit(benchmark::kMillisecond);
+
+//---decoding---//
+static void BM_decode(benchmark::State &state) {
+    std::vector<isa::encoded_instruction> encoded;
+    for (const auto &inst: random_instructions()) encoded.push_back(inst.encode());
+
+    for (auto _: state)
+        for (const auto &encoding: encoded) benchmark::DoNotOptimize(isa::instruction(encoding));
+
+    state.SetItemsProcessed(state.iterations() * encoded.size());
+}
+
+//a whole .text image
+static std::vector<uint8_t> encoded_text() {
+    const auto &instructions = random_instructions();
+    std::vector<uint8_t> text(instructions.size() * 4);
+    text.resize(isa::encode_many(instructions, text.data(), 0));
+    return text;
+}
+
+//the image decoded one instruction at a time into the same output as decode_many
+static void BM_decode_one_by_one(benchmark::State &state) {
+    const auto text = encoded_text();
+
+    std::vector<isa::located_instruction> decoded;
+    for (auto _: state) {
+        decoded.clear();
+        decoded.reserve(text.size() / 2);
+        for (uint32_t address = 0; address < text.size();) {
+            const uint8_t *bytes = text.data() + address;
+            isa::encoded_instruction encoded;
+            encoded.fullword = 0;
+            if ((bytes[0] & 1) != 0) {
+                encoded.size = isa::instruction_size_type::fullword;
+                encoded.fullword = bytes[0] | bytes[1] << 8 | bytes[2] << 16 |
+                                   (uint32_t) bytes[3] << 24;
+            } else {
+                encoded.size = isa::instruction_size_type::halfword;
+                encoded.halfword = bytes[0] | bytes[1] << 8;
+            }
+
+            decoded.push_back(
+                    {.address = address, .size = encoded.size, .inst = isa::instruction(encoded)});
+            address += encoded.size == isa::instruction_size_type::fullword ? 4 : 2;
+        }
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * random_instructions().size());
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+static void BM_decode_many(benchmark::State &state) {
+    const auto text = encoded_text();
+
+    std::vector<isa::located_instruction> decoded;
+    for (auto _: state) {
+        decoded.clear();
+        isa::decode_many(text, decoded);
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * random_instructions().size());
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK(BM_decode)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_decode_one_by_one)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_decode_many)->Unit(benchmark::kMillisecond);
+
+//---inst_id lookup---//
+//the linear scan over inst_type_lut that the decode tables replaced
+static isa::inst_id linear_inst_id(uint8_t opcode, uint8_t funcode,
+                                   isa::instruction_size_type size) {
+    const bool is_halfword = (size == isa::instruction_size_type::halfword);
+    for (int i = 0; i < (int) isa::inst_id::LAST; ++i) {
+        const auto &type = isa::inst_type_lut[(isa::inst_id) i];
+        if (type.opcode == opcode && type.is_halfword == is_halfword && type.funcode == funcode)
+            return (isa::inst_id) i;
+    }
+
+    return isa::inst_id::INVALID;
+}
+
+template<auto lookup>
+static void lookup_inst_ids(benchmark::State &state) {
+    const auto &instructions = random_instructions();
+
+    for (auto _: state) {
+        for (const auto &inst: instructions) {
+            const auto &type = isa::inst_type_lut[inst.id];
+            const auto size = type.is_halfword ? isa::instruction_size_type::halfword
+                                               : isa::instruction_size_type::fullword;
+            benchmark::DoNotOptimize(lookup(type.opcode, type.funcode, size));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * instructions.size());
+}
+
+static void BM_inst_id_table(benchmark::State &state) {
+    lookup_inst_ids<isa::get_inst_id_from_encoding>(state);
+}
+
+static void BM_inst_id_linear_scan(benchmark::State &state) {
+    lookup_inst_ids<linear_inst_id>(state);
+}
+
+BENCHMARK(BM_inst_id_table)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_inst_id_linear_scan)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "asm_lang.h"
+#include "isa.h"
+
+//---keywords---//
+static const std::vector<std::string> mnemonics = {
+        "add",   "sub",   "mult",  "div",   "multu",  "divu",   "eql",   "neql", "grt",
+        "grtu",  "gre",   "greu",  "lsft",  "rsft",   "rsfta",  "nor",   "nand", "or",
+        "and",   "xor",   "xnor",  "xori",  "ori",    "andi",   "addi",  "multi", "divi",
+        "multui", "divui", "lsfti", "rsfti", "rsftia", "neg",   "not",   "lw",   "lh",
+        "lb",    "lhu",   "lbu",   "sw",    "sh",     "sb",     "beq",   "bne",  "bgr",
+        "bgru",  "bge",   "bgeu",  "jmp",   "jal",    "set"};
+
+static const std::vector<std::string> directives = {
+        ".text",       ".data",          ".bss",        ".word",       ".halfword", ".byte",
+        ".word_array", ".halfword_array", ".byte_array", ".externdata", ".externex", ".global"};
+
+static std::vector<std::string> register_names() {
+    std::vector<std::string> names;
+    for (const auto &[id, name]: magic_enum::enum_entries<isa::reg_id>())
+        if (id < isa::reg_id::LAST) names.emplace_back(name);
+    return names;
+}
+
+//the keywords repeated in a fixed pseudo random order, so the branch predictor can't learn it
+static std::vector<std::string> lookup_stream(const std::vector<std::string> &keywords) {
+    std::vector<std::string> stream;
+    for (int i = 0; i < 256; i++) stream.insert(stream.end(), keywords.begin(), keywords.end());
+    std::ranges::shuffle(stream, std::mt19937(1));
+    return stream;
+}
+
+template<class lookup_t>
+static void run_lookups(benchmark::State &state, const std::vector<std::string> &keywords,
+                        lookup_t lookup) {
+    const auto stream = lookup_stream(keywords);
+
+    for (auto _: state)
+        for (const auto &key: stream) benchmark::DoNotOptimize(lookup(key));
+
+    state.SetItemsProcessed(state.iterations() * stream.size());
+}
+
+//---mnemonics---//
+static void BM_mnemonic_perfect_hash(benchmark::State &state) {
+    run_lookups(state, mnemonics, [](const std::string &key) {
+        return asm_lang::string_to_instruction_map.find(key);
+    });
+}
+
+//the map the perfect hash replaced
+static void BM_mnemonic_unordered_map(benchmark::State &state) {
+    std::unordered_map<std::string, asm_lang::inst_statement_info> map;
+    for (const auto &name: mnemonics)
+        map.emplace(name, *asm_lang::string_to_instruction_map.find(name));
+
+    run_lookups(state, mnemonics, [&](const std::string &key) { return map.find(key); });
+}
+
+BENCHMARK(BM_mnemonic_perfect_hash);
+BENCHMARK(BM_mnemonic_unordered_map);
+
+//---directives---//
+static void BM_directive_perfect_hash(benchmark::State &state) {
+    run_lookups(state, directives, [](const std::string &key) {
+        return asm_lang::string_to_directive_map.find(key);
+    });
+}
+
+static void BM_directive_unordered_map(benchmark::State &state) {
+    std::unordered_map<std::string_view, asm_lang::directive_info> map;
+    for (const auto &name: directives)
+        map.emplace(name, *asm_lang::string_to_directive_map.find(name));
+
+    run_lookups(state, directives,
+                [&](const std::string &key) { return map.find(std::string_view{key}); });
+}
+
+BENCHMARK(BM_directive_perfect_hash);
+BENCHMARK(BM_directive_unordered_map);
+
+//---registers---//
+static void BM_register_perfect_hash(benchmark::State &state) {
+    run_lookups(state, register_names(),
+                [](const std::string &key) { return isa::string_to_reg_id_map.find(key); });
+}
+
+//enum_name_lookup built a std::map of the enumerator names
+static void BM_register_map(benchmark::State &state) {
+    std::map<std::string, isa::reg_id> map;
+    for (const auto &name: register_names())
+        map.emplace(name, *isa::string_to_reg_id_map.find(name));
+
+    run_lookups(state, register_names(), [&](const std::string &key) { return map.find(key); });
+}
+
+BENCHMARK(BM_register_perfect_hash);
+BENCHMARK(BM_register_map);
@@ -0,0 +1,29 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_source.h"
+#include "lexer.h"
+
+//tokens per second and source MB/s of one backend over the generated source
+static void lex_source(benchmark::State &state, lexer_backend backend) {
+    const std::string source = generated_source(bench_source_size);
+
+    std::size_t ntokens = 0;
+    for (auto _: state) {
+        lexer lex(source, backend);
+        ntokens = 0;
+        while (lex.fetch_token().get_type() != lexer::token::types::eof) ntokens++;
+        benchmark::DoNotOptimize(ntokens);
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+    state.counters["tokens_per_second"] =
+            benchmark::Counter(state.iterations() * ntokens, benchmark::Counter::kIsRate);
+}
+
+static void BM_lex_simd(benchmark::State &state) { lex_source(state, lexer_backend::simd); }
+BENCHMARK(BM_lex_simd)->Unit(benchmark::kMillisecond);
+
+#ifdef ASSEMBLER_FLEX_LEXER
+static void BM_lex_flex(benchmark::State &state) { lex_source(state, lexer_backend::flex); }
+BENCHMARK(BM_lex_flex)->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "disassembly.h"
+#include "elf_image.h"
+#include "time_report.h"
+
+//disassembler <input elf> [-o <output listing>] [-j <threads>] [--time-report]
+//the listing goes to stdout without -o, -j defaults to every hardware thread
+int main(int argc, char *args[]) {
+    const char *input_fname = nullptr;
+    const char *output_fname = nullptr;
+    unsigned njobs = std::max(1u, std::thread::hardware_concurrency());
+
+    //---parse options---//
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(args[i], "--time-report") == 0) {
+            time_report::enable();
+        } else if (std::strcmp(args[i], "-o") == 0) {
+            if (++i == argc) throw std::runtime_error("missing filename after -o");
+            output_fname = args[i];
+        } else if (std::strcmp(args[i], "-j") == 0) {
+            if (++i == argc) throw std::runtime_error("missing job count after -j");
+            njobs = std::stoul(args[i]);
+            if (njobs == 0) throw std::runtime_error("job count must be at least 1");
+        } else if (args[i][0] == '-') {
+            throw std::runtime_error("unrecognized option");
+        } else if (input_fname == nullptr) {
+            input_fname = args[i];
+        } else {
+            throw std::runtime_error("input file specified more than ones");
+        }
+    }
+
+    if (input_fname == nullptr) throw std::runtime_error("no input file specified");
+
+    FILE *output = stdout;
+    if (output_fname != nullptr) {
+        output = fopen(output_fname, "w");
+        if (output == nullptr) throw std::runtime_error("could not write output file");
+    }
+
+    //---disassemble---//
+    std::size_t text_size = 0;
+    std::size_t listing_size = 0;
+    std::size_t ninstructions = 0;
+    std::chrono::steady_clock::duration duration{};
+    {
+        time_report::phase disassembly_phase("disassembly");
+        const auto start = std::chrono::steady_clock::now();
+
+        const auto image = elf_image::map_file(input_fname);
+        if (const auto text_section = image.find_section(".text"))
+            text_size = text_section->sh_size;
+
+        listing_buffer listing(output);
+        ninstructions = disassemble_text(image, listing, njobs);
+        listing.flush();
+        listing_size = listing.size();
+
+        duration = std::chrono::steady_clock::now() - start;
+    }
+
+    if (output != stdout) fclose(output);
+
+    //---throughput---//
+    const double seconds = std::chrono::duration<double>(duration).count();
+    time_report::set_counter(".text bytes", text_size);
+    time_report::set_counter("instructions", ninstructions);
+    time_report::set_counter("listing bytes", listing_size);
+    if (seconds > 0) {
+        time_report::set_counter(".text MB/s", (int64_t) (text_size / seconds / 1e6));
+        time_report::set_counter("listing MB/s", (int64_t) (listing_size / seconds / 1e6));
+    }
+
+    time_report::print(std::cerr);
+    return 0;
+}
@@ -8,8 +8,10 @@
 #include <cctype>
 #include <map>
 #include <string>
+#include <string_view>
 
 #include "magic_enum/magic_enum.hpp"
+#include "perfect_hash.h"
 #include "templates.h"
 
 namespace asm_lang {
@@ -130,7 +132,7 @@ struct directive_info {
     };
 };
 
-const static std::unordered_map<std::string_view, directive_info> string_to_directive_map{
+static constexpr auto string_to_directive_map = make_perfect_hash_map<directive_info>({
         {".text", {.type = directive_type::section, .section_id = section_directive_id::text}},
         {".data", {.type = directive_type::section, .section_id = section_directive_id::data}},
         {".bss", {.type = directive_type::section, .section_id = section_directive_id::bss}},
@@ -141,21 +143,27 @@ const static std::unordered_map<std::string_view, directive_info> string_to_dire
         {".halfword_array",
          {.type = directive_type::data, .data_id = data_directive_id::halfword_array}},
         {".byte_array", {.type = directive_type::data, .data_id = data_directive_id::byte_array}},
-        {".bss", {.type = directive_type::section, .section_id = section_directive_id::bss}},
         {".externdata",
          {.type = directive_type::symbol, .sym_id = symbol_directive_id::extern_data}},
         {".externex", {.type = directive_type::symbol, .sym_id = symbol_directive_id::extern_ex}},
         {".global", {.type = directive_type::symbol, .sym_id = symbol_directive_id::global}},
-};
+});
 
-inline bool string_to_directive_info(const std::string &str, directive_info &result) {
-    const auto it = string_to_directive_map.find(str);
-    if (it == string_to_directive_map.end()) return false;
+inline bool string_to_directive_info(std::string_view str, directive_info &result) {
+    const auto info = string_to_directive_map.find(str);
+    if (info == nullptr) return false;
 
-    result = it->second;
+    result = *info;
     return true;
 }
 
+//directive named in the source code, resolved at compile time (the keyword rules of F.l)
+consteval const directive_info *directive_info_of(std::string_view name) {
+    const auto info = string_to_directive_map.find(name);
+    if (info == nullptr) throw "unknown directive";
+    return info;
+}
+
 struct inst_statement_info {
     inst_statement_type type;
     union {
@@ -169,7 +177,7 @@ struct inst_statement_info {
     };
 };
 
-const static std::unordered_map<std::string, inst_statement_info> string_to_instruction_map{
+static constexpr auto string_to_instruction_map = make_perfect_hash_map<inst_statement_info>({
         //register arithmetic
         {"add", {.type = inst_statement_type::reg_arith, .reg_arith = reg_arith_statement_id::Add}},
         {"sub", {.type = inst_statement_type::reg_arith, .reg_arith = reg_arith_statement_id::Sub}},
@@ -261,17 +269,24 @@ const static std::unordered_map<std::string, inst_statement_info> string_to_inst
         {"jmp", {.type = inst_statement_type::jump, .jump = jump_statement_id::Jmp}},
         {"jal", {.type = inst_statement_type::jump, .jump = jump_statement_id::Jal}},
         //set
-        {"set", {.type = inst_statement_type::set, .set = set_statement_id::set}}};
+        {"set", {.type = inst_statement_type::set, .set = set_statement_id::set}}});
 
-inline bool string_to_instruction_info(const std::string &str, inst_statement_info &info) {
-    const auto it = string_to_instruction_map.find(str);
+inline bool string_to_instruction_info(std::string_view str, inst_statement_info &info) {
+    const auto found = string_to_instruction_map.find(str);
 
-    if (it == string_to_instruction_map.end()) return false;
+    if (found == nullptr) return false;
 
-    info = it->second;
+    info = *found;
     return true;
 }
 
+//mnemonic named in the source code, resolved at compile time (the keyword rules of F.l)
+consteval inst_statement_info instruction_info_of(std::string_view name) {
+    const auto found = string_to_instruction_map.find(name);
+    if (found == nullptr) throw "unknown mnemonic";
+    return *found;
+}
+
 
 }// namespace asm_lang
 
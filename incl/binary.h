@@ -5,6 +5,8 @@
 #ifndef ASSEMBLER_BINARY_H
 #define ASSEMBLER_BINARY_H
 
+#include <cstdint>
+
 namespace binary {
 enum struct section_t {
     text,
@@ -26,6 +28,17 @@ enum struct reloc_type {
     dummy = 7
 };
 
+//granularity of load segments in an executable layout
+constexpr uint32_t page_size = 0x1000;
+
+//virtual addresses the sections start at in an executable layout
+struct section_addresses {
+    uint32_t text = 0;
+    uint32_t rodata = 0;
+    uint32_t data = 0;
+    uint32_t bss = 0;
+};
+
 }
 
 #endif//ASSEMBLER_BINARY_H
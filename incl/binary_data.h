@@ -4,11 +4,16 @@
 
 #ifndef ASSEMBLER_BINARY_DATA_H
 #define ASSEMBLER_BINARY_DATA_H
+#include <algorithm>
+#include <array>
 #include <inttypes.h>
+#include <span>
 #include <vector>
 
+#include "parallel.h"
+
 namespace binary_data {
-    enum struct allignment_t { byte = 0, halfword = 1, word = 2 };
+    enum struct allignment_t : uint8_t { byte = 0, halfword = 1, word = 2 };
 
     struct memory_alloc_t {
         uint32_t nbytes = 0;
@@ -61,6 +66,82 @@ namespace binary_data {
             count_m = 0;
         }
     };
+
+    //what laying out a run of allocations does to an address: the padding only depends on the address
+    //modulo 4, so a run ends at address + advance[address % 4].
+    struct layout_summary {
+        std::array<uint32_t, 4> advance{};
+        uint32_t end(uint32_t address) const {
+            return address + advance[address % 4];
+        }
+    };
+
+    inline layout_summary summarize(std::span<const memory_alloc_t> allocs) {
+        //---follow the four start phases until they meet---//
+        //after the first word aligned allocation they all continue from the same phase
+        std::array<alligned_counter, 4> counters{0, 1, 2, 3};
+        std::size_t i = 0;
+        for (; i < allocs.size(); i++) {
+            for (auto &counter: counters) counter.increment(allocs[i]);
+
+            const uint32_t phase = counters[0].get_count() % 4;
+            if (counters[1].get_count() % 4 == phase && counters[2].get_count() % 4 == phase &&
+                counters[3].get_count() % 4 == phase) {
+                i++;
+                break;
+            }
+        }
+
+        //---the rest advances every phase by the same amount---//
+        alligned_counter rest(counters[0].get_count());
+        for (; i < allocs.size(); i++) rest.increment(allocs[i]);
+        const uint32_t rest_advance = rest.get_count() - counters[0].get_count();
+
+        layout_summary summary;
+        for (uint32_t r = 0; r < 4; r++)
+            summary.advance[r] = counters[r].get_count() - r + rest_advance;
+        return summary;
+    }
+
+    //places allocs one after the other from start, writes the address of every alloc and returns the end.
+    //With more than one job the allocs are split in blocks: every block is summarized in parallel,
+    //a scan over the summaries gives the start of every block and the blocks are then placed in parallel.
+    inline uint32_t layout(std::span<const memory_alloc_t> allocs, std::span<uint32_t> addresses,
+                           uint32_t start, unsigned njobs) {
+        static constexpr std::size_t block_size = 1 << 14;
+
+        const auto place = [&](std::size_t first, std::size_t last, uint32_t address) {
+            alligned_counter counter(address);
+            for (std::size_t i = first; i < last; i++) addresses[i] = counter.increment(allocs[i]);
+            return counter.get_count();
+        };
+
+        const std::size_t nblocks = (allocs.size() + block_size - 1) / block_size;
+        if (njobs <= 1 || nblocks <= 1) return place(0, allocs.size(), start);
+
+        //---summarize every block---//
+        std::vector<layout_summary> summaries(nblocks);
+        parallel_for(nblocks, njobs, [&](std::size_t b) {
+            const std::size_t first = b * block_size;
+            summaries[b] = summarize(allocs.subspan(first, std::min(block_size, allocs.size() - first)));
+        });
+
+        //---scan, start address of every block---//
+        std::vector<uint32_t> block_starts(nblocks);
+        uint32_t address = start;
+        for (std::size_t b = 0; b < nblocks; b++) {
+            block_starts[b] = address;
+            address = summaries[b].end(address);
+        }
+
+        //---place every block---//
+        parallel_for(nblocks, njobs, [&](std::size_t b) {
+            const std::size_t first = b * block_size;
+            place(first, std::min(first + block_size, allocs.size()), block_starts[b]);
+        });
+
+        return address;
+    }
 }
 
 
@@ -5,16 +5,32 @@
 #ifndef ASSEMBLER_COMPILATION_UNIT_T_H
 #define ASSEMBLER_COMPILATION_UNIT_T_H
 
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "binary.h"
 #include "isa.h"
 #include "symbol_table.h"
 #include "binary_data.h"
 
+//final placement of one text statement
+struct text_layout_entry {
+    uint32_t address;
+    uint16_t compile_case;
+    uint8_t nbytes;
+    binary_data::allignment_t allignment;
+};
+static_assert(sizeof(text_layout_entry) == 8);
+
 struct compilation_unit {
     symbol_table st;
     std::vector<binary_data::data_alloc_t> data;
     std::vector<binary_data::data_alloc_t> rodata;
     std::vector<binary_data::data_alloc_t> bss;
-    std::vector<isa::instruction> instructions;
+    std::vector<uint8_t> text;//encoded machine code
+    std::vector<text_layout_entry> text_layout;//one entry per text statement, in statement order
+    std::optional<binary::section_addresses> exec_addresses;//only set for an executable layout
 };
 
 #endif//ASSEMBLER_COMPILATION_UNIT_T_H
@@ -0,0 +1,85 @@
+#ifndef ASSEMBLER_DISASSEMBLY_H
+#define ASSEMBLER_DISASSEMBLY_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "elf_image.h"
+#include "isa.h"
+
+//output buffer for large listings. Text is formatted in place into one reusable block
+//that is written out whenever a line might not fit anymore. Without an output file the block
+//grows instead, the listing of a chunk formatted on a worker thread is kept that way
+class listing_buffer {
+public:
+    static const std::size_t block_size = 1 << 20;
+    static const std::size_t max_line = 256;//longest line formatted without a bounds check
+
+private:
+    FILE *output_m;//nullptr when the listing stays in memory
+    std::vector<char> block_m;
+    char *pos_m;
+    char *line_m;//start of the current line, for column padding
+    std::size_t nwritten_m = 0;
+
+    //room for n more characters, by writing out or by growing the block
+    void make_room(std::size_t n);
+    void append_long(std::string_view str);
+
+public:
+    listing_buffer(FILE *output);
+    listing_buffer() : listing_buffer(nullptr) {}
+    ~listing_buffer() { flush(); }
+
+    listing_buffer(const listing_buffer &) = delete;
+    listing_buffer &operator=(const listing_buffer &) = delete;
+
+    //makes room for max_line characters and starts a new line
+    void begin_line() {
+        if (block_m.data() + block_m.size() - pos_m < (std::ptrdiff_t) max_line)
+            make_room(max_line);
+        line_m = pos_m;
+    }
+
+    void append(char c) { *pos_m++ = c; }
+    //strings may be longer than max_line, symbol names are not limited
+    void append(std::string_view str) {
+        if (str.size() > (std::size_t) (block_m.data() + block_m.size() - pos_m)) {
+            append_long(str);
+            return;
+        }
+
+        std::memcpy(pos_m, str.data(), str.size());
+        pos_m += str.size();
+    }
+    void append_hex(uint32_t val, int ndigits);
+    void append_decimal(int64_t val);
+    //pads the current line with spaces up to column
+    void pad_to(std::size_t column);
+
+    void flush();
+
+    //what is buffered and not written out yet, everything for an in memory listing
+    std::string_view view() const {
+        return {block_m.data(), (std::size_t) (pos_m - block_m.data())};
+    }
+    //drops what is buffered, an in memory listing is reused for the next chunk
+    void clear() {
+        nwritten_m = 0;
+        pos_m = line_m = block_m.data();
+    }
+
+    //bytes written out so far
+    std::size_t size() const { return nwritten_m + (pos_m - block_m.data()); }
+};
+
+//writes a listing of the .text section: the address, encoding and instruction of every
+//instruction, symbol labels, branch targets as symbol+offset and the relocations of .text.
+//Chunks of .text are decoded and formatted on up to njobs threads and written out in order,
+//the listing does not depend on njobs. Returns the number of instructions
+std::size_t disassemble_text(const elf_image &image, listing_buffer &out, unsigned njobs = 1);
+
+#endif//ASSEMBLER_DISASSEMBLY_H
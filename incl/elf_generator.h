@@ -5,7 +5,12 @@
 #ifndef ASSEMBLER_ELF_GENERATOR_H
 #define ASSEMBLER_ELF_GENERATOR_H
 
-#include "elfio/elfio.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "elfio/elf_types.hpp"
+#include "binary.h"
 #include "binary_data.h"
 #include "symbol_table.h"
 #include "isa.h"
@@ -21,40 +26,73 @@ public:
         none,
     };
 
+    //zero allocations of at least this many bytes are only counted,
+    //they become holes in the output file instead of stored zeros
+    static constexpr uint32_t min_zero_run = 4096;
+
 private:
-    const std::string output_fname;
-    ELFIO::elfio writer;
+    //output written front to back, defined in elf_generator.cpp
+    class output_file;
+
+    //contents of one section. Bytes are stored without the zero runs,
+    //a nobits section (.bss) stores nothing and only has a size
+    class section_buffer {
+        struct zero_run {
+            uint32_t offset;//section offset the run starts at
+            uint32_t nbytes;
+        };
+
+        std::string bytes_m;
+        std::vector<zero_run> zero_runs_m;
+        uint32_t size_m = 0;
+        bool nobits_m;
+
+    public:
+        explicit section_buffer(bool nobits = false) : nobits_m(nobits) {}
+
+        uint32_t size() const { return size_m; }
+        void reserve(uint32_t nbytes) { if (!nobits_m) bytes_m.reserve(nbytes); }
+
+        //appends nbytes to be filled in by the caller
+        char *grow(std::size_t nbytes);
+        void push_zeros(std::size_t nbytes);
+
+        //writes the section at the current position of out, the zero runs are skipped over
+        void write_to(output_file &out) const;
+    };
 
-    ELFIO::section *text_sec;
-    ELFIO::section *rodata_sec;
-    ELFIO::section *data_sec;
-    ELFIO::section *bss_sec;
+    const std::string output_fname;
 
-    ELFIO::section *str_sec;
-    ELFIO::section *sym_sec;
-    ELFIO::section *rel_sec;
+    //entries are kept in file format, write() lays them out behind the section data
+    std::string strtab;
+    std::vector<ELFIO::Elf32_Sym> symtab;
+    std::vector<ELFIO::Elf32_Rel> reltab;
 
-    std::string text;
-    std::string rodata;
-    std::string data;
-    std::string bss;
+    section_buffer text;
+    section_buffer rodata;
+    section_buffer data;
+    section_buffer bss{true};
     section_t working_section = section_t::none;
-    std::string &get_working_data();
+    section_buffer &get_working_data();
 
     uint32_t entry_point = 0;
+    std::optional<binary::section_addresses> exec_addresses;
 
-    void initialise();
     uint32_t allign_to(binary_data::allignment_t allignment);
-    void insert_data(uint8_t val);
-    void insert_data(uint16_t val);
-    void insert_data(uint32_t val);
 
-    ELFIO::Elf_Half get_sec_index(binary::section_t section);
+    static ELFIO::Elf_Half get_sec_index(binary::section_t section);
 public:
-    elf_generator(const std::string &fname) : output_fname(fname) {initialise(); }
+    elf_generator(const std::string &fname) : output_fname(fname) {}
     void set_entrypoint(uint32_t address);
 
-    uint32_t push_instruction(const isa::instruction &inst);
+    //lays the file out to be mapped by a loader: the program sections get their virtual addresses
+    //and page aligned file offsets, and are described by PT_LOAD segments
+    void set_exec_layout(const binary::section_addresses &addresses);
+
+    //reserves the bytes the working section will store, so pushes never reallocate
+    void reserve(uint32_t nbytes);
+
+    uint32_t push_bytes(const uint8_t *bytes, std::size_t nbytes);
     uint32_t push_data(const binary_data::data_alloc_t &data_alloc);
     uint32_t push_data(uint8_t val);
     uint32_t push_data(uint16_t val);
@@ -66,7 +104,7 @@ public:
     void set_bss_section();
     void set_rodata_section();
 
-    uint32_t add_string(const std::string &str);
+    uint32_t add_string(const char *str);
     uint32_t insert_symbol_def(const symbol &sym);
     void insert_symbol_ref(const symbol_ref &sref);
 
@@ -0,0 +1,47 @@
+#ifndef ASSEMBLER_ELF_IMAGE_H
+#define ASSEMBLER_ELF_IMAGE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+#include "elfio/elf_types.hpp"
+#include "source_buffer.h"
+
+//read only view of a 32 bit little endian elf file as written by elf_generator.
+//The file is mapped, sections, symbols and relocations are views into the mapping
+class elf_image {
+    source_buffer file_m;
+    const ELFIO::Elf32_Ehdr *header_m = nullptr;
+    std::span<const ELFIO::Elf32_Shdr> sections_m;
+    const ELFIO::Elf32_Shdr *symtab_m = nullptr;
+
+    template<typename entry_t>
+    std::span<const entry_t> section_entries(const ELFIO::Elf32_Shdr &section) const;
+
+public:
+    static elf_image map_file(const std::filesystem::path &path);
+
+    uint32_t entry() const { return header_m->e_entry; }
+
+    std::span<const ELFIO::Elf32_Shdr> sections() const { return sections_m; }
+    std::string_view section_name(const ELFIO::Elf32_Shdr &section) const;
+    //nullptr when there is no section by that name
+    const ELFIO::Elf32_Shdr *find_section(std::string_view name) const;
+    std::size_t section_index(const ELFIO::Elf32_Shdr &section) const {
+        return &section - sections_m.data();
+    }
+
+    //empty for SHT_NOBITS sections
+    std::span<const uint8_t> section_data(const ELFIO::Elf32_Shdr &section) const;
+
+    //empty without a .symtab
+    std::span<const ELFIO::Elf32_Sym> symbols() const;
+    std::string_view symbol_name(const ELFIO::Elf32_Sym &sym) const;
+
+    //entries of the SHT_REL section that applies to target, empty when there is none
+    std::span<const ELFIO::Elf32_Rel> relocations(const ELFIO::Elf32_Shdr &target) const;
+};
+
+#endif//ASSEMBLER_ELF_IMAGE_H
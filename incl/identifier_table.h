@@ -0,0 +1,57 @@
+#ifndef ASSEMBLER_IDENTIFIER_TABLE_H
+#define ASSEMBLER_IDENTIFIER_TABLE_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+//interns label names, every distinct name is stored once and referred to by a 32 bit handle.
+//The characters live in fixed blocks that are never moved, so views and handles stay valid
+//for the lifetime of the table. Interning is only done from the main thread (lexer and
+//semantic analysis), later phases only read.
+class identifier_table {
+public:
+    using handle = uint32_t;
+    static const handle none = 0;//the empty identifier
+
+private:
+    static constexpr std::size_t block_size = 1 << 16;
+
+    std::vector<std::unique_ptr<char[]>> blocks_m;
+    std::size_t block_used_m = block_size;
+
+    std::vector<std::string_view> strings_m;//indexed by handle
+    std::unordered_map<std::string_view, handle> handles_m;
+
+    std::string_view store(std::string_view str);
+
+public:
+    identifier_table();
+
+    identifier_table(const identifier_table &) = delete;
+    identifier_table &operator=(const identifier_table &) = delete;
+
+    handle intern(std::string_view str);
+
+    //lookup without interning, returns false when the name was never interned
+    bool find(std::string_view str, handle &result) const;
+
+    std::string_view view(handle id) const {
+        assert(id < strings_m.size());
+        return strings_m[id];
+    }
+
+    //stored strings are null terminated
+    const char *c_str(handle id) const { return view(id).data(); }
+
+    std::size_t size() const { return strings_m.size(); }
+};
+
+//the table shared by all compilation phases
+identifier_table &identifiers();
+
+#endif//ASSEMBLER_IDENTIFIER_TABLE_H
@@ -6,10 +6,14 @@
 #define ASSEMBLER_ISA_H
 
 #include "magic_enum/magic_enum.hpp"
+#include "perfect_hash.h"
 #include "templates.h"
+#include <array>
+#include <bit>
 #include <cctype>
 #include <map>
 #include <set>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -242,7 +246,7 @@ struct format_operand_form {
     bool imm;
 };
 
-static const enum_lut<isa::format_id, format_operand_form> format_operand_form_lut({
+static constexpr enum_lut<isa::format_id, format_operand_form> format_operand_form_lut({
         {isa::format_id::reg, {.dr = true, .sr1 = true, .sr2 = true, .imm = false}},
         {isa::format_id::branch, {.dr = false, .sr1 = true, .sr2 = true, .imm = true}},
         {isa::format_id::immediate, {.dr = true, .sr1 = true, .sr2 = false, .imm = true}},
@@ -267,7 +271,7 @@ struct inst_type {
     extension_type extension = extension_type::na;
 };
 
-static const enum_lut<inst_id, inst_type> inst_type_lut({
+static constexpr enum_lut<inst_id, inst_type> inst_type_lut({
         //branch instruction
         {inst_id::Sb, {format_id::branch, 0x0, 0x0, false, extension_type::sign}},
         {inst_id::Sh, {format_id::branch, 0x0, 0x1, false, extension_type::sign}},
@@ -369,7 +373,7 @@ public:
     inst_id_to_string_lut_t() {
         auto pairs = magic_enum::enum_entries<inst_id>();
         for (auto &p: pairs) {
-            if (p.first == inst_id::LAST)
+            if (p.first >= inst_id::LAST)
                 continue;
 
             lut[(uint) p.first] = p.second;
@@ -402,7 +406,6 @@ struct instruction {
     std::string to_str() const;
 
 private:
-    void encode_fullword_immediate(uint32_t &inst) const;
     void decode_fullword_immediate(uint32_t encoded_inst);
     void decode_fullword_instruction(uint32_t encoded_inst);
     void decode_halfword_instruction(uint16_t encoded_inst);
@@ -415,7 +418,7 @@ inline int inst_size(format_id format) {
     return 4;
 }
 
-inline bool is_store_inst(inst_id id) {
+constexpr bool is_store_inst(inst_id id) {
     return (id == inst_id::Sb || id == inst_id::Sw || id == inst_id::Sb);
 }
 
@@ -427,9 +430,261 @@ inline bool is_load_inst(inst_id id) {
             id == inst_id::Lbu);
 }
 
+//---encoding templates---//
+//an operand field of an encoded instruction, operand bits outside mask are dropped
+struct encoding_field {
+    uint8_t pos = 0;
+    uint32_t mask = 0;//zero when the format has no such operand
+};
+
+constexpr encoding_field make_encoding_field(uint pos, uint bitsize) {
+    return {.pos = (uint8_t) pos, .mask = (uint32_t) ((1u << bitsize) - 1)};
+}
+
+//where each operand goes for a format, immediates wider than imm_lower continue in imm_upper
+struct format_encoding {
+    encoding_field dr;
+    encoding_field sr1;
+    encoding_field sr2;
+    encoding_field imm_lower;
+    encoding_field imm_upper;
+    uint8_t imm_upper_shift = 0;
+};
+
+//every field is spelled out, the ones a format doesn't have are empty
+static constexpr enum_lut<format_id, format_encoding> format_encoding_lut({
+        {format_id::reg, {.dr = make_encoding_field(dr_pos, reg_bitsize),
+                          .sr1 = make_encoding_field(sr1_pos, reg_bitsize),
+                          .sr2 = make_encoding_field(sr2_pos, reg_bitsize),
+                          .imm_lower = {},
+                          .imm_upper = {},
+                          .imm_upper_shift = 0}},
+        {format_id::branch, {.dr = {},
+                             .sr1 = make_encoding_field(sr1_pos, reg_bitsize),
+                             .sr2 = make_encoding_field(sr2_pos, reg_bitsize),
+                             .imm_lower = make_encoding_field(branch_lowerimmediate_pos,
+                                                              branch_lowerimmediate_bitsize),
+                             .imm_upper = make_encoding_field(branch_upperimmediate_pos,
+                                                              branch_upperimmediate_bitsize),
+                             .imm_upper_shift = branch_lowerimmediate_bitsize}},
+        {format_id::immediate, {.dr = make_encoding_field(dr_pos, reg_bitsize),
+                                .sr1 = make_encoding_field(sr1_pos, reg_bitsize),
+                                .sr2 = {},
+                                .imm_lower = make_encoding_field(imm_immediate_pos,
+                                                                 imm_immediate_bitsize),
+                                .imm_upper = {},
+                                .imm_upper_shift = 0}},
+        {format_id::set, {.dr = make_encoding_field(dr_pos, reg_bitsize),
+                          .sr1 = {},
+                          .sr2 = {},
+                          .imm_lower = make_encoding_field(set_immediate_pos,
+                                                           set_immediate_bitsize),
+                          .imm_upper = {},
+                          .imm_upper_shift = 0}},
+        {format_id::jump, {.dr = {},
+                           .sr1 = {},
+                           .sr2 = {},
+                           .imm_lower = make_encoding_field(jump_immediate_pos,
+                                                            jump_immediate_bitsize),
+                           .imm_upper = {},
+                           .imm_upper_shift = 0}},
+        {format_id::half_reg, {.dr = make_encoding_field(halfword_dr_pos, reg_bitsize),
+                               .sr1 = {},
+                               .sr2 = make_encoding_field(halfword_sr_pos, reg_bitsize),
+                               .imm_lower = {},
+                               .imm_upper = {},
+                               .imm_upper_shift = 0}},
+        {format_id::half_immediate, {.dr = make_encoding_field(halfword_dr_pos, reg_bitsize),
+                                     .sr1 = {},
+                                     .sr2 = {},
+                                     .imm_lower = make_encoding_field(halfword_immediate_pos,
+                                                                      halfword_immediate_bitsize),
+                                     .imm_upper = {},
+                                     .imm_upper_shift = 0}},
+});
+
+//everything about the encoding of an inst_id that does not depend on its operands
+struct encoding_template {
+    uint32_t fixed_bits = 0;//bitmode, opcode and funcode
+    format_encoding fields;
+    bool is_halfword = false;
+    bool halve_immediate = false;//jump and branch offsets are stored in halfwords
+};
+
+constexpr encoding_template make_encoding_template(inst_id id) {
+    const inst_type &type = inst_type_lut[id];
+
+    encoding_template tmpl;
+    tmpl.fields = format_encoding_lut[type.format];
+    tmpl.is_halfword = type.is_halfword;
+    tmpl.halve_immediate = type.format == format_id::jump ||
+                           (type.format == format_id::branch && is_store_inst(id) == false);
+
+    tmpl.fixed_bits = (uint32_t) type.opcode << opcode_pos;
+    if (type.is_halfword == false) {
+        tmpl.fixed_bits |= 1u << bitmode_pos;
+        tmpl.fixed_bits |= (uint32_t) type.funcode << fun_pos;
+    }
+
+    return tmpl;
+}
+
+static constexpr enum_lut<inst_id, encoding_template> encoding_template_lut(make_encoding_template);
+
+//encodes insts back to back into the section at text + offset, each aligned to its size and in
+//little endian. Alignment is relative to text, padding bytes are left untouched.
+//Returns the offset after the last instruction.
+uint32_t encode_many(std::span<const instruction> insts, uint8_t *text, uint32_t offset);
+
+//---decode tables---//
+//direct indexed by (size, opcode, funcode), built from inst_type_lut. Where encodings collide the
+//first inst_id in inst_type_lut wins, like the linear scan these tables replace did
+constexpr std::size_t decode_index(uint8_t opcode, uint8_t funcode, instruction_size_type size) {
+    const std::size_t halfword = size == instruction_size_type::halfword ? 1 : 0;
+    return (((halfword << opcode_bitsize) | (opcode & ((1u << opcode_bitsize) - 1))) << longfun_bitsize) |
+           (funcode & ((1u << longfun_bitsize) - 1));
+}
+
+constexpr std::size_t decode_lut_size = 2u << (opcode_bitsize + longfun_bitsize);
+
+constexpr std::array<inst_id, decode_lut_size> make_inst_id_decode_lut() {
+    std::array<inst_id, decode_lut_size> lut{};
+    lut.fill(inst_id::INVALID);
+
+    for (std::size_t i = 0; i < (std::size_t) inst_id::LAST; i++) {
+        const inst_type &type = inst_type_lut[(inst_id) i];
+        const auto size = type.is_halfword ? instruction_size_type::halfword : instruction_size_type::fullword;
+        inst_id &entry = lut[decode_index(type.opcode, type.funcode, size)];
+        if (entry == inst_id::INVALID) entry = (inst_id) i;
+    }
+
+    return lut;
+}
+
+//indexed by decode_index(opcode, 0, size) >> longfun_bitsize
+constexpr std::array<format_id, (decode_lut_size >> longfun_bitsize)> make_format_decode_lut() {
+    std::array<format_id, (decode_lut_size >> longfun_bitsize)> lut{};
+    lut.fill(format_id::INVALID);
+
+    for (std::size_t i = 0; i < (std::size_t) inst_id::LAST; i++) {
+        const inst_type &type = inst_type_lut[(inst_id) i];
+        const auto size = type.is_halfword ? instruction_size_type::halfword : instruction_size_type::fullword;
+        format_id &entry = lut[decode_index(type.opcode, 0, size) >> longfun_bitsize];
+        if (entry == format_id::INVALID) entry = type.format;
+    }
+
+    return lut;
+}
+
+static constexpr auto inst_id_decode_lut = make_inst_id_decode_lut();
+static constexpr auto format_decode_lut = make_format_decode_lut();
+
+//everything decode_many needs to rebuild an inst_id from its encoding without branching on the
+//format, mirrors encoding_template. Operands a format doesn't have get an empty field and decode
+//to zero, like instruction(encoded_instruction) which stays the reference decoder
+struct decoding_template {
+    format_id format;
+    encoding_field dr;
+    encoding_field sr1;
+    encoding_field sr2;
+    reg_id dr_fixed = reg_id::zero;//or-ed into dr, rjali links to ra
+    encoding_field imm_lower;
+    encoding_field imm_upper;
+    uint8_t imm_upper_shift = 0;
+    uint8_t imm_sign_pos = 0;
+    uint32_t imm_one_bits = 0;//set for one extension
+    uint32_t imm_sign_bits = 0;//set when bit imm_sign_pos is, for sign extension
+    uint8_t imm_shift = 0;
+};
+
+constexpr decoding_template make_decoding_template(inst_id id) {
+    const inst_type &type = inst_type_lut[id];
+    const format_encoding &fields = format_encoding_lut[type.format];
+
+    decoding_template tmpl;
+    tmpl.format = type.format;
+    tmpl.dr = fields.dr;
+    tmpl.sr1 = fields.sr1;
+    tmpl.sr2 = fields.sr2;
+    tmpl.imm_lower = fields.imm_lower;
+    tmpl.imm_upper = fields.imm_upper;
+    tmpl.imm_upper_shift = fields.imm_upper_shift;
+
+    //halfwords read and write the same register
+    if (type.is_halfword && id != inst_id::Mov && id != inst_id::Jalr)
+        tmpl.sr1 = fields.dr;
+
+    if (id == inst_id::Rjali)
+        tmpl.dr_fixed = reg_id::ra;
+
+    if (type.format == format_id::jump ||
+        (type.format == format_id::branch && is_store_inst(id) == false))
+        tmpl.imm_shift = 1;
+
+    //sui and apci fill the upper bits
+    if (id == inst_id::Sui || id == inst_id::Apci) {
+        tmpl.imm_shift = 32 - set_immediate_bitsize;
+        return tmpl;
+    }
+
+    if (tmpl.imm_lower.mask == 0)
+        return tmpl;
+
+    uint8_t width = std::bit_width(tmpl.imm_lower.mask);
+    if (tmpl.imm_upper.mask != 0)
+        width = tmpl.imm_upper_shift + std::bit_width(tmpl.imm_upper.mask);
+
+    const uint32_t fence = ~0u << width;
+    tmpl.imm_sign_pos = width - 1;
+    if (type.extension == extension_type::one)
+        tmpl.imm_one_bits = fence;
+    else if (type.extension == extension_type::sign)
+        tmpl.imm_sign_bits = fence;
+
+    return tmpl;
+}
+
+static constexpr enum_lut<inst_id, decoding_template> decoding_template_lut(make_decoding_template);
+
+//funcode bits per fullword opcode, immediate and branch have a short one and reg a long one
+constexpr std::array<uint8_t, 1u << opcode_bitsize> make_funcode_mask_lut() {
+    std::array<uint8_t, 1u << opcode_bitsize> lut{};
+
+    for (uint32_t opcode = 0; opcode < lut.size(); opcode++) {
+        const std::size_t index = decode_index(opcode, 0, instruction_size_type::fullword);
+        const format_id format = format_decode_lut[index >> longfun_bitsize];
+        if (format == format_id::immediate || format == format_id::branch)
+            lut[opcode] = (1u << shortfun_bitsize) - 1;
+        else if (format == format_id::reg)
+            lut[opcode] = (1u << longfun_bitsize) - 1;
+    }
+
+    return lut;
+}
+
+static constexpr auto funcode_mask_lut = make_funcode_mask_lut();
+
+struct located_instruction {
+    uint32_t address;
+    instruction_size_type size;
+    instruction inst;
+};
+
+//decodes a whole .text image in address order, zero padding decodes as a halfword nop.
+//Fullwords are 4 byte aligned, a fullword bitmode anywhere else decodes as an INVALID halfword
+void decode_many(std::span<const uint8_t> text, std::vector<located_instruction> &out);
+
 static const std::string_view reg_id_to_string(reg_id id);
 
-static auto string_to_reg_id = enum_name_lookup<reg_id>;
+static constexpr auto string_to_reg_id_map = make_enum_name_hash_map<reg_id>();
+
+inline bool string_to_reg_id(std::string_view name, reg_id &id) {
+    const auto found = string_to_reg_id_map.find(name);
+    if (found == nullptr) return false;
+
+    id = *found;
+    return true;
+}
 
 instruction make_set_inst(inst_id id, reg_id dr, int32_t imm);
 
@@ -550,23 +805,11 @@ inline isa::inst_type isa::get_inst_type(inst_id id) {
 }
 
 inline isa::format_id isa::get_format_from_encoding(uint8_t opcode, instruction_size_type size) {
-    for (auto &type: inst_type_lut) {
-        if (type.opcode == opcode && (type.is_halfword == (size == instruction_size_type::halfword)))
-            return (type.format);
-    }
-
-    return format_id::INVALID;
+    return format_decode_lut[decode_index(opcode, 0, size) >> longfun_bitsize];
 }
 
 inline isa::inst_id isa::get_inst_id_from_encoding(uint8_t opcode, uint8_t funcode, isa::instruction_size_type size) {
-    for (int i = 0; i < (int) inst_id::LAST; ++i) {
-        const auto &type = inst_type_lut[i];
-        if (type.opcode == opcode && (type.is_halfword == (size == instruction_size_type::halfword)) &&
-            type.funcode == funcode)
-            return ((inst_id) i);
-    }
-
-    return inst_id::INVALID;
+    return inst_id_decode_lut[decode_index(opcode, funcode, size)];
 }
 
 #endif//ASSEMBLER_ISA_H
@@ -5,16 +5,60 @@
 #ifndef ASSEMBLER_LEXER_H
 #define ASSEMBLER_LEXER_H
 
-#include "F.h"
+#include <optional>
 #include <string>
 #include "magic_enum/magic_enum.hpp"
-#include <fstream>
+#include <string_view>
 #include <exception>
 #include "isa.h"
 #include "asm_lang.h"
+#include "identifier_table.h"
+#include "ring_buffer.h"
+#include "simd_scanner.h"
+#include "program_options.h"
+
+#ifdef ASSEMBLER_FLEX_LEXER
+//the scanner generated from F.l includes this header with FlexLexer.h already included
+#ifndef FLEX_SCANNER
+#include "F.h"
+#endif
+
+//scanner generated from F.l
+class flex_scanner : public yyFlexLexer {
+    //unscanned part of the source, handed to flex in chunks by LexerInput
+    std::string_view source_m;
+    //streamed source (pipelined preprocessor output), used instead of source_m when set
+    ring_buffer *source_ring_m = nullptr;
+
+    //ids of the last keyword token, set by the keyword rules of F.l
+    asm_lang::inst_statement_info mnemonic_m{};
+    isa::reg_id reg_m = isa::reg_id::LAST;
+    const asm_lang::directive_info *directive_m = nullptr;
 
-class lexer : public yyFlexLexer {
-    std::fstream file_m;
+public:
+    flex_scanner(std::string_view source) : source_m(source){};
+    flex_scanner(ring_buffer &source) : source_ring_m(&source){};
+
+    //the rules of F.l, generated by flex (%option yyclass)
+    int yylex() override;
+
+    int scan() { return yylex(); }
+    std::string_view text() const { return std::string_view(YYText(), YYLeng()); }
+    int line() const { return lineno(); }
+
+    //---ids of the last token, only valid for the matching token type---//
+    const asm_lang::inst_statement_info &mnemonic() const { return mnemonic_m; }
+    //reg_id::LAST for registers the isa does not have (r0-r3)
+    isa::reg_id reg() const { return reg_m; }
+    //nullptr for unknown directives
+    const asm_lang::directive_info *directive() const { return directive_m; }
+
+protected:
+    int LexerInput(char *buf, int max_size) override;
+};
+#endif
+
+class lexer {
 public:
     class token
     {
@@ -43,27 +87,51 @@ public:
     private:
 	int line = -1;
 	types id = types::none;
-        std::string text_m;
+        //points into the scanner buffer, only valid until the next fetch_token()
+        std::string_view text_m;
+
+        //ids resolved by the scanner, the member matching the token type is set
+        union {
+            asm_lang::inst_statement_info mnemonic_m;
+            isa::reg_id reg_m;//reg_id::LAST for registers the isa does not have (r0-r3)
+            const asm_lang::directive_info *directive_m;//nullptr for unknown directives
+            identifier_table::handle label_m;//interned name of label tokens
+        };
         static const std::string &type_to_string(types typ);
 
     public:
 	int get_line() const;
         bool is_integer() const;
         const types get_type() const { return id; }
-        const std::string &get_text() const { return text_m; }
+        std::string_view get_text() const { return text_m; }
+        const asm_lang::inst_statement_info &get_mnemonic() const { return mnemonic_m; }
+        isa::reg_id get_reg() const { return reg_m; }
+        const asm_lang::directive_info *get_directive() const { return directive_m; }
+        identifier_table::handle get_label() const { return label_m; }
         const std::string to_string() const;
     };
 
 private:
     token read_token_m;
 
+    //exactly one backend is constructed
+#ifdef ASSEMBLER_FLEX_LEXER
+    std::optional<flex_scanner> flex_m;
+#endif
+    std::optional<simd_scanner> simd_m;
+
+    template<class source_t>
+    void open_scanner(source_t &source, lexer_backend backend);
+
+    template<class scanner_t>
+    void read_token(scanner_t &scanner, token::types token_type);
+
 public:
-    using yyFlexLexer::yyFlexLexer;
-    lexer(std::fstream &str) : lexer(str, std::cout){};
-    lexer(std::fstream *str) : lexer(str, &std::cout){};
+    lexer(std::string_view source, lexer_backend backend);
+    lexer(ring_buffer &source, lexer_backend backend);
 
-    token last_token() {return read_token_m;};
-    token fetch_token();
+    const token &last_token() const {return read_token_m;};
+    const token &fetch_token();
 };
 
 std::ostream &operator<<(std::ostream &strm, lexer::token &tk);
@@ -0,0 +1,52 @@
+#ifndef ASSEMBLER_PARALLEL_H
+#define ASSEMBLER_PARALLEL_H
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//runs fn(i) for every i in [0, n) on up to njobs threads, the calling thread is one of them.
+//Indices are handed out one at a time, so uneven tasks still balance.
+//When tasks throw, the exception of the lowest index is rethrown on the calling thread,
+//the same one a sequential loop would have thrown first.
+template<typename fn_t>
+void parallel_for(std::size_t n, unsigned njobs, fn_t &&fn) {
+    if (njobs <= 1 || n <= 1) {
+        for (std::size_t i = 0; i < n; i++) fn(i);
+        return;
+    }
+
+    std::atomic<std::size_t> next_index = 0;
+    std::mutex error_mutex;
+    std::size_t error_index = n;
+    std::exception_ptr error;
+
+    const auto worker = [&]() {
+        for (std::size_t i = next_index++; i < n; i = next_index++) {
+            try {
+                fn(i);
+            } catch (...) {
+                std::lock_guard lock(error_mutex);
+                if (i < error_index) {
+                    error_index = i;
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const std::size_t nthreads = std::min<std::size_t>(njobs, n) - 1;
+    threads.reserve(nthreads);
+    for (std::size_t t = 0; t < nthreads; t++) threads.emplace_back(worker);
+
+    worker();
+    for (auto &thread: threads) thread.join();
+
+    if (error) std::rethrow_exception(error);
+}
+
+#endif//ASSEMBLER_PARALLEL_H
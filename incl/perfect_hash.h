@@ -0,0 +1,148 @@
+#ifndef ASSEMBLER_PERFECT_HASH_H
+#define ASSEMBLER_PERFECT_HASH_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "magic_enum/magic_enum.hpp"
+
+namespace perfect_hash {
+
+constexpr uint32_t hash(std::string_view key, uint32_t seed) {
+    //fnv-1a with the seed mixed into the offset basis
+    uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+    for (const char c: key) {
+        h ^= (uint8_t) c;
+        h *= 16777619u;
+    }
+
+    //final avalanche, so the low bits used for the slot index depend on every character
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+    return h;
+}
+
+}// namespace perfect_hash
+
+//string keyed lookup table for a fixed set of keys, built at compile time with hash and displace:
+//keys are grouped into buckets by a first hash, each bucket stores the seed of a second hash
+//that sends all its keys to free slots. A lookup is two hashes and one string compare.
+template<typename value_t, std::size_t n>
+class perfect_hash_map {
+public:
+    using entry_t = std::pair<std::string_view, value_t>;
+
+private:
+    static constexpr std::size_t nslots = std::bit_ceil(n);
+    static constexpr std::size_t nbuckets = n / 2 + 1;
+    static constexpr uint32_t max_seed = 1 << 16;
+
+    std::array<uint32_t, nbuckets> seeds_m{};
+    std::array<entry_t, nslots> slots_m{};
+
+    static constexpr std::size_t slot_index(std::string_view key, uint32_t seed) {
+        return perfect_hash::hash(key, seed) & (nslots - 1);
+    }
+
+public:
+    //fails to compile on duplicate or empty keys
+    constexpr perfect_hash_map(const entry_t (&entries)[n]) {
+        for (std::size_t i = 0; i < n; i++) {
+            if (entries[i].first.empty()) throw "perfect_hash_map: empty key";
+
+            for (std::size_t j = 0; j < i; j++)
+                if (entries[i].first == entries[j].first) throw "perfect_hash_map: duplicate key";
+        }
+
+        //---group keys into buckets---//
+        std::array<std::size_t, n> key_bucket{};
+        std::array<std::size_t, nbuckets> bucket_size{};
+        for (std::size_t i = 0; i < n; i++) {
+            key_bucket[i] = perfect_hash::hash(entries[i].first, 0) % nbuckets;
+            bucket_size[key_bucket[i]]++;
+        }
+
+        //---place the largest buckets first, they are the hardest to fit---//
+        std::array<std::size_t, nbuckets> order{};
+        for (std::size_t b = 0; b < nbuckets; b++) {
+            std::size_t pos = b;
+            for (; pos > 0 && bucket_size[order[pos - 1]] < bucket_size[b]; pos--)
+                order[pos] = order[pos - 1];
+            order[pos] = b;
+        }
+
+        //---find a seed per bucket that sends its keys to free slots---//
+        std::array<bool, nslots> used{};
+        for (const std::size_t bucket: order) {
+            if (bucket_size[bucket] == 0) break;
+
+            for (uint32_t seed = 1;; seed++) {
+                if (seed == max_seed) throw "perfect_hash_map: no seed found";
+
+                bool fits = true;
+                std::size_t nplaced = 0;
+                for (std::size_t i = 0; i < n && fits; i++) {
+                    if (key_bucket[i] != bucket) continue;
+
+                    const std::size_t slot = slot_index(entries[i].first, seed);
+                    if (used[slot]) {
+                        fits = false;
+                    } else {
+                        used[slot] = true;
+                        nplaced++;
+                    }
+                }
+
+                //---undo the tentative placement---//
+                if (fits == false) {
+                    for (std::size_t i = 0; i < n && nplaced != 0; i++) {
+                        if (key_bucket[i] != bucket) continue;
+                        used[slot_index(entries[i].first, seed)] = false;
+                        nplaced--;
+                    }
+                    continue;
+                }
+
+                seeds_m[bucket] = seed;
+                for (std::size_t i = 0; i < n; i++)
+                    if (key_bucket[i] == bucket) slots_m[slot_index(entries[i].first, seed)] = entries[i];
+                break;
+            }
+        }
+    }
+
+    //returns nullptr when the key is not in the table
+    constexpr const value_t *find(std::string_view key) const {
+        const uint32_t seed = seeds_m[perfect_hash::hash(key, 0) % nbuckets];
+        const entry_t &slot = slots_m[slot_index(key, seed)];
+
+        if (slot.first.empty() || slot.first != key) return nullptr;
+        return &slot.second;
+    }
+
+    constexpr bool contains(std::string_view key) const { return find(key) != nullptr; }
+};
+
+template<typename value_t, std::size_t n>
+constexpr perfect_hash_map<value_t, n>
+make_perfect_hash_map(const std::pair<std::string_view, value_t> (&entries)[n]) {
+    return perfect_hash_map<value_t, n>(entries);
+}
+
+//maps the names of enum_t::LAST contiguous enumerators, starting from zero, to their value
+template<typename enum_t>
+constexpr auto make_enum_name_hash_map() {
+    constexpr std::size_t n = (std::size_t) enum_t::LAST;
+
+    std::pair<std::string_view, enum_t> entries[n]{};
+    for (const auto &[id, name]: magic_enum::enum_entries<enum_t>())
+        if (id < enum_t::LAST) entries[(std::size_t) id] = {name, id};
+
+    return perfect_hash_map<enum_t, n>(entries);
+}
+
+#endif//ASSEMBLER_PERFECT_HASH_H
@@ -0,0 +1,44 @@
+#ifndef ASSEMBLER_PREPROCESSOR_H
+#define ASSEMBLER_PREPROCESSOR_H
+
+#include <cstdio>
+#include <string_view>
+#include <thread>
+
+#include "ring_buffer.h"
+#include "source_buffer.h"
+
+//returns false when the source contains none of the characters gpp acts on in its default mode,
+//'#' starts every meta macro (#define, #include, #ifdef, ...) and '\' is the quote character,
+//without those gpp copies its input unchanged
+bool needs_preprocessing(std::string_view source);
+
+//runs gpp over the source on a producer thread, its output FILE* feeds a bounded ring buffer
+//that the lexer drains, so at most the ring capacity of preprocessed output is held in memory
+class preprocessor_pipeline {
+    static const std::size_t ring_capacity = 1 << 20;
+
+    ring_buffer ring_m;
+    FILE *tee_m;//receives a copy of the output when not null (--savepp)
+    bool output_closed_m = false;
+    std::thread producer_m;
+
+    void produce(char **argv, const source_buffer &source);
+
+    static ssize_t write_output(void *cookie, const char *buf, size_t size);
+    static int close_output(void *cookie);
+
+public:
+    //argv is passed on to gpp
+    preprocessor_pipeline(char **argv, const source_buffer &source, FILE *tee = nullptr);
+
+    //stops reading (gpp's remaining output is discarded) and waits for gpp to finish
+    ~preprocessor_pipeline();
+
+    preprocessor_pipeline(const preprocessor_pipeline &) = delete;
+    preprocessor_pipeline &operator=(const preprocessor_pipeline &) = delete;
+
+    ring_buffer &output() { return ring_m; }
+};
+
+#endif//ASSEMBLER_PREPROCESSOR_H
@@ -8,12 +8,24 @@
 #include <filesystem>
 #include <map>
 
+//the hand written simd scanner is always built, the flex scanner only with ASSEMBLER_FLEX_LEXER
+enum struct lexer_backend {
+    flex,
+    simd
+};
+
 class program_options {
 public:
     std::filesystem::path input_fname;
     std::filesystem::path output_fname;
     bool short_jumps;
     bool save_pp_result;
+    bool preprocess;
+    bool time_report;
+    unsigned jobs;//threads used for text layout and generation
+    bool zero_data_to_bss;//zero initialised .data objects are placed in .bss
+    bool exec_layout;//sections get virtual addresses and load segments
+    lexer_backend lexer;
     program_options(int argc, char *args[]);
 
     program_options(const program_options &a) = delete;
@@ -30,13 +42,25 @@ private:
     enum struct option_id {
         output = 0,
         short_jump,
-        save_pp_result
+        save_pp_result,
+        no_preprocess,
+        time_report,
+        lexer,
+        jobs,
+        zero_data_to_bss,
+        exec_layout
     };
 
     static inline std::map<std::string, option_id> option_name_map {
             {"-o", option_id::output},
             {"--savepp", option_id::save_pp_result},
+            {"--no-pp", option_id::no_preprocess},
             {"--shortjumps", option_id::short_jump},
+            {"--time-report", option_id::time_report},
+            {"--lexer", option_id::lexer},
+            {"-j", option_id::jobs},
+            {"--zero-data-to-bss", option_id::zero_data_to_bss},
+            {"--exec-layout", option_id::exec_layout},
     };
 };
 
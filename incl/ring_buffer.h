@@ -0,0 +1,39 @@
+#ifndef ASSEMBLER_RING_BUFFER_H
+#define ASSEMBLER_RING_BUFFER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+//bounded byte fifo between one writer thread and one reader thread
+class ring_buffer {
+    std::vector<char> data_m;
+    std::size_t head_m = 0;//read position
+    std::size_t count_m = 0;//number of unread bytes
+
+    bool write_closed_m = false;
+    bool read_closed_m = false;
+
+    std::mutex mutex_m;
+    std::condition_variable readable_m;
+    std::condition_variable writable_m;
+
+public:
+    explicit ring_buffer(std::size_t capacity) : data_m(capacity){};
+
+    ring_buffer(const ring_buffer &) = delete;
+    ring_buffer &operator=(const ring_buffer &) = delete;
+
+    //blocks until every byte is stored, returns false when the reader has closed its end
+    bool write(const char *buf, std::size_t nbytes);
+
+    //blocks until at least one byte is available, returns 0 once the writer has closed its end
+    //and everything has been read
+    std::size_t read(char *buf, std::size_t max_size);
+
+    void close_write();
+    void close_read();
+};
+
+#endif//ASSEMBLER_RING_BUFFER_H
@@ -5,11 +5,16 @@
 #ifndef ASSEMBLER_SEMANTIC_STATEMENT_H
 #define ASSEMBLER_SEMANTIC_STATEMENT_H
 
+#include <algorithm>
+#include <array>
+#include <initializer_list>
 #include <inttypes.h>
 #include <memory>
 #include <stdbool.h>
 #include <stdexcept>
 #include <string>
+#include <optional>
+#include <variant>
 #include <vector>
 #include <bit>
 
@@ -18,6 +23,7 @@
 #include "symbol_table.h"
 #include "syntax.h"
 #include "binary_data.h"
+#include "identifier_table.h"
 #include "program_options.h"
 
 namespace semantic_statements {
@@ -25,7 +31,7 @@ namespace semantic_statements {
 using section_t = asm_lang::section_directive_id;
 
 struct label_t {
-    std::string identifier = "";
+    identifier_table::handle identifier = identifier_table::none;
     int32_t symbol_id = 0;
 };
 
@@ -36,7 +42,29 @@ struct label_operand {
 
 using reg_t = isa::reg_id;
 
-class inst_statement_i {
+//instructions generated for one statement, kept inline since no statement expands to more than three
+class inst_buffer {
+public:
+    static const std::size_t capacity = 3;
+
+private:
+    std::array<isa::instruction, capacity> instructions_m;
+    std::size_t size_m = 0;
+
+public:
+    inst_buffer(std::initializer_list<isa::instruction> instructions) : size_m(instructions.size()) {
+        assert(instructions.size() <= capacity);
+        std::copy(instructions.begin(), instructions.end(), instructions_m.begin());
+    }
+
+    std::size_t size() const { return size_m; }
+    const isa::instruction *begin() const { return instructions_m.data(); }
+    const isa::instruction *end() const { return instructions_m.data() + size_m; }
+};
+
+//label shared by all instruction statement kinds, the kinds themselves are dispatched statically
+//through inst_statement below
+class inst_statement_base {
     label_t label_m;
     bool has_label_m = false;
 
@@ -52,22 +80,14 @@ public:
         return label_m;
     }
 
-    void set_label(std::string &&label) {
-        label_m = {std::move(label)};
+    void set_label(identifier_table::handle label) {
+        label_m = {label};
         has_label_m = true;
     }
 
-    virtual int get_compile_case(const symbol_table &st, uint32_t pc,
-                                 const program_options &options) const = 0;
-    virtual binary_data::memory_alloc_t get_size(int comp_case_int) const = 0;
-    virtual std::vector<isa::instruction>
-    gen_instructions(int comp_case_int, const symbol_table &st,
-                     uint32_t pc) const = 0;
-    virtual bool has_label_operand() const = 0;
-    virtual label_operand &get_label_operand() = 0;
-    const virtual label_operand &get_label_operand() const = 0;
-    virtual binary::reloc_type get_reloc_type(int comp_case_int,
-                                              const symbol_table &st) const {return binary::reloc_type::none;};
+    binary::reloc_type get_reloc_type(int comp_case_int, const symbol_table &st) const {
+        return binary::reloc_type::none;
+    }
 };
 
 static uint unsigned_bitwidth(uint64_t val) { return std::bit_width((uint64_t) val); }
@@ -84,8 +104,11 @@ static uint signed_bitwidth(int64_t val) {
 static bool set_register(const syntax::arg &arg, reg_t &reg) {
     if (arg.type != syntax::arg_type::reg) { return false; }
 
-    const bool found_reg = isa::string_to_reg_id(arg.str_val, reg);
-    return found_reg;
+    //resolved by the lexer, registers outside the isa are LAST
+    if (arg.reg_val == isa::reg_id::LAST) return false;
+
+    reg = arg.reg_val;
+    return true;
 }
 
 static bool set_immediate(const syntax::arg &arg, int32_t &imm) {
@@ -101,7 +124,7 @@ static bool set_label_operand(const syntax::arg &arg, label_operand &lbl_op) {
     if(arg.type != syntax::arg_type::label)
         return false;
 
-    lbl_op.label.identifier = arg.str_val;
+    lbl_op.label.identifier = arg.label_val;
     return true;
 }
 
@@ -114,7 +137,7 @@ static bool set_label_operand_offset(const syntax::arg &arg,
     return true;
 }
 
-class reg_arith_statement : public inst_statement_i {
+class reg_arith_statement : public inst_statement_base {
     enum struct compile_case_t {
         undetermined = 0,
         halfword,
@@ -127,23 +150,21 @@ class reg_arith_statement : public inst_statement_i {
     reg_t source1;
     reg_t source2;
 
-    std::vector<isa::instruction> gen_fullword_instructions() const;
-    std::vector<isa::instruction> gen_halfword_instructions() const;
+    inst_buffer gen_fullword_instructions() const;
+    inst_buffer gen_halfword_instructions() const;
 
 public:
     reg_arith_statement(const syntax::statement &inst_stmnt, asm_lang::reg_arith_statement_id id);
     int get_compile_case(const symbol_table &st, uint32_t pc,
-                         const program_options &options) const override;
-    binary_data::memory_alloc_t get_size(int comp_case_int) const override;
-    std::vector<isa::instruction> gen_instructions(int comp_case_int,
-                                                   const symbol_table &st,
-                                                   uint32_t pc) const override;
-    bool has_label_operand() const override { return false; };
-    label_operand &get_label_operand() override { assert(false); };
-    const label_operand &get_label_operand() const override { assert(false); };
+                         const program_options &options) const;
+    binary_data::memory_alloc_t get_size(int comp_case_int) const;
+    inst_buffer gen_instructions(int comp_case_int, const symbol_table &st, uint32_t pc) const;
+    bool has_label_operand() const { return false; };
+    label_operand &get_label_operand() { assert(false); };
+    const label_operand &get_label_operand() const { assert(false); };
 };
 
-class immediate_arith_statement : public inst_statement_i {
+class immediate_arith_statement : public inst_statement_base {
     enum struct compile_case_t {
         undetermined = 0,
         fullword,
@@ -162,18 +183,16 @@ public:
     immediate_arith_statement(const syntax::statement &inst_stmnt,
                               asm_lang::immediate_arith_statement_id id);
     int get_compile_case(const symbol_table &st, uint32_t pc,
-                         const program_options &options) const override;
-    binary_data::memory_alloc_t get_size(int comp_case_int) const override;
-    std::vector<isa::instruction> gen_instructions(int comp_case_int,
-                                                   const symbol_table &st,
-                                                   uint32_t pc) const override;
-    bool has_label_operand() const override { return false; }
-    label_operand &get_label_operand() override { assert(false); };
-    const label_operand &get_label_operand() const override { assert(false); };
+                         const program_options &options) const;
+    binary_data::memory_alloc_t get_size(int comp_case_int) const;
+    inst_buffer gen_instructions(int comp_case_int, const symbol_table &st, uint32_t pc) const;
+    bool has_label_operand() const { return false; }
+    label_operand &get_label_operand() { assert(false); };
+    const label_operand &get_label_operand() const { assert(false); };
 
 };
 
-class branch_statement : public inst_statement_i {
+class branch_statement : public inst_statement_base {
     enum struct compile_case_t {
         undetermined = 0,
         long_branch,
@@ -189,18 +208,15 @@ public:
     branch_statement(const syntax::statement &inst_stmnt,
                      asm_lang::branch_statement_id id);
     int get_compile_case(const symbol_table &st, uint32_t pc,
-                         const program_options &options) const override;
-    binary_data::memory_alloc_t get_size(int comp_case_int) const override;
-    std::vector<isa::instruction> gen_instructions(int comp_case_int,
-                                                   const symbol_table &st,
-                                                   uint32_t pc) const override;
-    bool has_label_operand() const override { return true;};
-    label_operand &get_label_operand() override { return jump_label; };
-    const label_operand &get_label_operand() const override { return jump_label; };
-    virtual binary::reloc_type get_reloc_type() {return binary::reloc_type::dummy;};
+                         const program_options &options) const;
+    binary_data::memory_alloc_t get_size(int comp_case_int) const;
+    inst_buffer gen_instructions(int comp_case_int, const symbol_table &st, uint32_t pc) const;
+    bool has_label_operand() const { return true;};
+    label_operand &get_label_operand() { return jump_label; };
+    const label_operand &get_label_operand() const { return jump_label; };
 };
 
-class jump_statement : public inst_statement_i {
+class jump_statement : public inst_statement_base {
     enum struct compile_case_t {
         undetermined = 0,
         reg_jump,
@@ -223,31 +239,29 @@ public:
                    asm_lang::jump_statement_id id);
 
     int get_compile_case(const symbol_table &st, uint32_t pc,
-                         const program_options &options) const override;
+                         const program_options &options) const;
 
-    binary_data::memory_alloc_t get_size(int comp_case_int) const override;
-    std::vector<isa::instruction> gen_instructions(int comp_case_int,
-                                                   const symbol_table &st,
-                                                   uint32_t pc) const override;
-    bool has_label_operand() const override {
+    binary_data::memory_alloc_t get_size(int comp_case_int) const;
+    inst_buffer gen_instructions(int comp_case_int, const symbol_table &st, uint32_t pc) const;
+    bool has_label_operand() const {
         return (dest_type == destination_types::address);
     };
 
-    label_operand &get_label_operand() override {
+    label_operand &get_label_operand() {
         assert(dest_type == destination_types::address);
         return offset;
     };
 
-    const label_operand &get_label_operand() const override {
+    const label_operand &get_label_operand() const {
         assert(dest_type == destination_types::address);
         return offset;
     };
 
     binary::reloc_type get_reloc_type(int comp_case_int,
-                                      const symbol_table &st) const override;
+                                      const symbol_table &st) const;
 };
 
-class unary_statement : public inst_statement_i {
+class unary_statement : public inst_statement_base {
     enum struct compile_case_t {
         undetermined = 0,
         half_reg,
@@ -263,17 +277,15 @@ public:
     unary_statement(const syntax::statement &inst_stmnt,
                     asm_lang::unary_statement_id id);
     int get_compile_case(const symbol_table &st, uint32_t pc,
-                         const program_options &options) const override;
-    binary_data::memory_alloc_t get_size(int comp_case_int) const override;
-    std::vector<isa::instruction> gen_instructions(int comp_case_int,
-                                                   const symbol_table &st,
-                                                   uint32_t pc) const override;
-    bool has_label_operand() const override { return false; };
-    label_operand &get_label_operand() override { assert(false); };
-    const label_operand &get_label_operand() const override { assert(false); };
+                         const program_options &options) const;
+    binary_data::memory_alloc_t get_size(int comp_case_int) const;
+    inst_buffer gen_instructions(int comp_case_int, const symbol_table &st, uint32_t pc) const;
+    bool has_label_operand() const { return false; };
+    label_operand &get_label_operand() { assert(false); };
+    const label_operand &get_label_operand() const { assert(false); };
 };
 
-class set_statement : public inst_statement_i {
+class set_statement : public inst_statement_base {
     enum struct source_types {
         address_label,
         integer,
@@ -303,22 +315,20 @@ class set_statement : public inst_statement_i {
 public:
     set_statement(const syntax::statement &inst_stmnt, asm_lang::set_statement_id);
     int get_compile_case(const symbol_table &st, uint32_t pc,
-                         const program_options &options) const override;
-    binary_data::memory_alloc_t get_size(int comp_case_int) const override;
-    std::vector<isa::instruction> gen_instructions(int comp_case_int,
-                                                   const symbol_table &st,
-                                                   uint32_t pc) const override;
-    bool has_label_operand() const override {
+                         const program_options &options) const;
+    binary_data::memory_alloc_t get_size(int comp_case_int) const;
+    inst_buffer gen_instructions(int comp_case_int, const symbol_table &st, uint32_t pc) const;
+    bool has_label_operand() const {
         return (src_type == source_types::address_label);
     };
 
-    label_operand &get_label_operand() override { return source_address; };
-    const label_operand &get_label_operand() const override { return source_address; };
+    label_operand &get_label_operand() { return source_address; };
+    const label_operand &get_label_operand() const { return source_address; };
     binary::reloc_type get_reloc_type(int comp_case_int,
-                                      const symbol_table &st) const override;
+                                      const symbol_table &st) const;
 };
 
-class data_statement : public inst_statement_i {
+class data_statement : public inst_statement_base {
     enum struct compile_case_t {
         undetermined = 0,
         short_reg,
@@ -339,22 +349,89 @@ public:
                     asm_lang::data_statement_id id);
 
     int get_compile_case(const symbol_table &st, uint32_t pc,
-                         const program_options &options) const override;
-    binary_data::memory_alloc_t get_size(int comp_case) const override;
-    std::vector<isa::instruction> gen_instructions(int comp_case,
-                                                   const symbol_table &st,
-                                                   uint32_t pc) const override;
-
-    bool has_label_operand() const override { return has_label_operand_m;};
-    label_operand &get_label_operand() override {
+                         const program_options &options) const;
+    binary_data::memory_alloc_t get_size(int comp_case) const;
+    inst_buffer gen_instructions(int comp_case, const symbol_table &st, uint32_t pc) const;
+
+    bool has_label_operand() const { return has_label_operand_m;};
+    label_operand &get_label_operand() {
         assert(has_label_operand_m);
         return label_location;};
 
-    const label_operand &get_label_operand() const override {
+    const label_operand &get_label_operand() const {
         assert(has_label_operand_m);
         return label_location;};
 
-    binary::reloc_type get_reloc_type(int comp_case_int, const symbol_table &st) const override;
+    binary::reloc_type get_reloc_type(int comp_case_int, const symbol_table &st) const;
+};
+
+//instruction statement of any kind, stored by value so the text section is one contiguous array.
+//Calls are dispatched with std::visit, a jump on the kind index instead of a virtual call
+class inst_statement {
+    using kind_t = std::variant<reg_arith_statement, immediate_arith_statement, branch_statement,
+                                jump_statement, unary_statement, set_statement, data_statement>;
+    kind_t kind_m;
+
+    const inst_statement_base &base() const {
+        return std::visit([](const inst_statement_base &stmnt) -> const inst_statement_base & {
+            return stmnt;
+        }, kind_m);
+    }
+
+    inst_statement_base &base() {
+        return std::visit([](inst_statement_base &stmnt) -> inst_statement_base & {
+            return stmnt;
+        }, kind_m);
+    }
+
+public:
+    template<typename stmnt_t>
+    inst_statement(stmnt_t &&stmnt) : kind_m(std::forward<stmnt_t>(stmnt)) {}
+
+    bool has_label() const { return base().has_label(); }
+    const label_t &get_label() const { return base().get_label(); }
+    label_t &get_label() { return base().get_label(); }
+    void set_label(identifier_table::handle label) { base().set_label(label); }
+
+    int get_compile_case(const symbol_table &st, uint32_t pc,
+                         const program_options &options) const {
+        return std::visit([&](const auto &stmnt) {
+            return stmnt.get_compile_case(st, pc, options);
+        }, kind_m);
+    }
+
+    binary_data::memory_alloc_t get_size(int comp_case_int) const {
+        return std::visit([&](const auto &stmnt) { return stmnt.get_size(comp_case_int); }, kind_m);
+    }
+
+    inst_buffer gen_instructions(int comp_case_int, const symbol_table &st,
+                                                   uint32_t pc) const {
+        return std::visit([&](const auto &stmnt) {
+            return stmnt.gen_instructions(comp_case_int, st, pc);
+        }, kind_m);
+    }
+
+    bool has_label_operand() const {
+        return std::visit([](const auto &stmnt) { return stmnt.has_label_operand(); }, kind_m);
+    }
+
+    label_operand &get_label_operand() {
+        return std::visit([](auto &stmnt) -> label_operand & {
+            return stmnt.get_label_operand();
+        }, kind_m);
+    }
+
+    const label_operand &get_label_operand() const {
+        return std::visit([](const auto &stmnt) -> const label_operand & {
+            return stmnt.get_label_operand();
+        }, kind_m);
+    }
+
+    binary::reloc_type get_reloc_type(int comp_case_int, const symbol_table &st) const {
+        return std::visit([&](const auto &stmnt) {
+            return stmnt.get_reloc_type(comp_case_int, st);
+        }, kind_m);
+    }
 };
 
 class data_directive {
@@ -386,7 +463,7 @@ public:
 
 struct symbol_directive {
     asm_lang::symbol_directive_id id;
-    std::string identifier;
+    identifier_table::handle identifier;
 };
 
 class directive_statement {
@@ -428,23 +505,21 @@ public:
 
 private:
     types type_m;
-    std::unique_ptr<inst_statement_i> inst_stmnt_ptr_m;
+    std::optional<inst_statement> inst_stmnt_m;
     directive_statement dir_stmnt_m;
 
-    static void
-    produce_inst_statement(syntax::statement &&syn_inst_stmnt,
-                           std::unique_ptr<semantic_statements::inst_statement_i> &stmnt_ptr);
+    static inst_statement produce_inst_statement(const syntax::statement &syn_inst_stmnt);
 
 public:
     asm_statement(syntax::statement &&syn_stmnt);
     types get_type() const { return type_m; }
-    std::unique_ptr<inst_statement_i> &get_inst_stmnt() {
+    inst_statement &get_inst_stmnt() {
         assert(type_m == types::instruction_statement);
-        return inst_stmnt_ptr_m;
+        return *inst_stmnt_m;
     }
-    const std::unique_ptr<inst_statement_i> &get_inst_stmnt() const {
+    const inst_statement &get_inst_stmnt() const {
         assert(type_m == types::instruction_statement);
-        return inst_stmnt_ptr_m;
+        return *inst_stmnt_m;
     }
 
     directive_statement &get_dir_stmnt() {
@@ -0,0 +1,67 @@
+#ifndef ASSEMBLER_SIMD_SCANNER_H
+#define ASSEMBLER_SIMD_SCANNER_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "asm_lang.h"
+#include "isa.h"
+#include "ring_buffer.h"
+
+//hand written replacement for the flex scanner generated from F.l, it produces the same token stream.
+//Newlines, comments, blank runs and identifiers are scanned 16 (SSE2) or 32 (AVX2) bytes at a time.
+//Contiguous sources are scanned in place, streamed sources through a window that is refilled
+//whenever a token runs into the end of the window.
+class simd_scanner {
+    ring_buffer *source_ring_m = nullptr;
+    std::vector<char> window_m;//only used for streamed sources
+
+    const char *pos_m = nullptr;
+    const char *end_m = nullptr;
+    bool input_done_m = true;
+    bool hit_end_m = false;//set when a rule needed a character beyond end_m
+
+    const char *token_m = nullptr;
+    std::size_t token_size_m = 0;
+    int line_m = 1;
+
+    //ids of the last keyword token
+    asm_lang::inst_statement_info mnemonic_m{};
+    isa::reg_id reg_m = isa::reg_id::LAST;
+    const asm_lang::directive_info *directive_m = nullptr;
+
+    char peek(const char *it);
+    bool refill();
+
+    int scan_token(const char *start, const char *&token_end);
+    int classify_word(std::string_view word);
+    const char *scan_identifier(const char *it);
+    const char *scan_number(const char *it);
+    const char *scan_string(const char *it);
+
+public:
+    simd_scanner(std::string_view source);
+    simd_scanner(ring_buffer &source);
+
+    simd_scanner(const simd_scanner &) = delete;
+    simd_scanner &operator=(const simd_scanner &) = delete;
+
+    //returns the next token type (lexer::token::types), none tokens are skipped
+    int scan();
+
+    //text of the last token, only valid until the next scan()
+    std::string_view text() const { return {token_m, token_size_m}; }
+
+    //line number after the last token, counted like flex's yylineno
+    int line() const { return line_m; }
+
+    //---ids of the last token, only valid for the matching token type---//
+    const asm_lang::inst_statement_info &mnemonic() const { return mnemonic_m; }
+    //reg_id::LAST for registers the isa does not have (r0-r3)
+    isa::reg_id reg() const { return reg_m; }
+    //nullptr for unknown directives
+    const asm_lang::directive_info *directive() const { return directive_m; }
+};
+
+#endif//ASSEMBLER_SIMD_SCANNER_H
@@ -0,0 +1,38 @@
+#ifndef ASSEMBLER_SOURCE_BUFFER_H
+#define ASSEMBLER_SOURCE_BUFFER_H
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+//read only view of assembly source text that owns the memory behind it,
+//either a private read only mapping of a file or a malloc'ed buffer (open_memstream output)
+class source_buffer {
+    enum struct storage_t { none, mapped, heap };
+
+    const char *data_m = nullptr;
+    std::size_t size_m = 0;
+    storage_t storage_m = storage_t::none;
+
+    void release();
+
+public:
+    source_buffer() = default;
+    ~source_buffer() { release(); }
+
+    source_buffer(const source_buffer &) = delete;
+    source_buffer &operator=(const source_buffer &) = delete;
+    source_buffer(source_buffer &&other) noexcept;
+    source_buffer &operator=(source_buffer &&other) noexcept;
+
+    static source_buffer map_file(const std::filesystem::path &path);
+
+    //takes ownership of a buffer that has to be released with free()
+    static source_buffer adopt_heap(char *data, std::size_t size);
+
+    std::string_view view() const { return {data_m, size_m}; }
+    const char *data() const { return data_m; }
+    std::size_t size() const { return size_m; }
+};
+
+#endif//ASSEMBLER_SOURCE_BUFFER_H
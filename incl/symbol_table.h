@@ -5,11 +5,12 @@
 #ifndef ASSEMBLER_SYMBOL_TABLE_H
 #define ASSEMBLER_SYMBOL_TABLE_H
 
+#include <algorithm>
 #include <vector>
 #include <inttypes.h>
 #include <string>
 #include "binary.h"
-#include <map>
+#include "identifier_table.h"
 #include <assert.h>
 
 enum struct symbol_scope {
@@ -26,7 +27,7 @@ enum struct symbol_type {
 
 struct symbol {
     binary::section_t section = binary::section_t::undefined;
-    std::string identifier = "undefined";
+    identifier_table::handle identifier = identifier_table::none;
     uint32_t address = 0;
     symbol_type type = symbol_type::data;
     symbol_scope scope = symbol_scope::local;
@@ -40,7 +41,8 @@ struct symbol_ref {
 };
 
 class symbol_table {
-    std::map<std::string, int32_t> identifer_to_id;
+    //symbol id per identifier handle, 0 (the undefined symbol) for identifiers without a symbol
+    std::vector<int32_t> identifer_to_id;
     std::vector<symbol> symbols;
     std::vector<symbol_ref> refs;
 
@@ -50,15 +52,14 @@ public:
                                 //this will cause the symbol id's to be alligned with those returned from .symtab section in elf file binary generetor,
     }
 
-    int32_t get_id(const std::string &identifier, bool &found) const {
-        const auto it = identifer_to_id.find(identifier);
-        if (it == identifer_to_id.end()) {
+    int32_t get_id(identifier_table::handle identifier, bool &found) const {
+        if (identifier >= identifer_to_id.size() || identifer_to_id[identifier] == 0) {
             found = false;
             return 0;
         }
 
         found = true;
-        return it->second;
+        return identifer_to_id[identifier];
     }
 
     const symbol &get_symbol(int32_t id) const {
@@ -81,7 +82,9 @@ public:
         }
 
         int32_t id = symbols.size();
-        identifer_to_id.emplace(sym.identifier, id);
+        if (sym.identifier >= identifer_to_id.size())
+            identifer_to_id.resize(std::max<std::size_t>(sym.identifier + 1, identifer_to_id.size() * 2));
+        identifer_to_id[sym.identifier] = id;
         symbols.push_back(sym);
         success = true;
         return id;
@@ -92,6 +95,11 @@ public:
         symbols[id].address = address;
     }
 
+    //number of symbol ids, including the undefined symbol
+    std::size_t size() const {
+        return symbols.size();
+    }
+
     using iterator = std::vector<symbol>::iterator;
 
     iterator begin() {
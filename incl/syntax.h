@@ -6,24 +6,40 @@
 #define ASSEMBLER_SYNTAX_H
 
 #include <cstdint>
+#include <memory_resource>
 #include <vector>
 
+#include "asm_lang.h"
+#include "identifier_table.h"
+#include "isa.h"
 #include "lexer.h"
 #include "symbol_table.h"
 #include "address_counter.h"
 
 class syntax {
 private:
+    static const std::size_t arena_block_size = 1 << 16;
+    //a register operand for dr, sr1 and sr2 or two registers and an immediate
+    static const std::size_t max_inst_arguments = 3;
+
+    //backs the argument lists and strings of every parsed statement, they are released together
+    //with the parser instead of one by one. Statements must not outlive the parser.
+    std::pmr::monotonic_buffer_resource arena_m;
     lexer lex_m;
 public:
-    syntax(std::fstream &f) : lex_m(f) {
+    syntax(std::string_view source, lexer_backend backend)
+        : arena_m(arena_block_size), lex_m(source, backend) {
         lex_m.fetch_token();
     };
 
-    syntax(std::fstream *f) : lex_m(f) {
+    syntax(ring_buffer &source, lexer_backend backend)
+        : arena_m(arena_block_size), lex_m(source, backend) {
         lex_m.fetch_token();
     };
 
+    syntax(const syntax &) = delete;
+    syntax &operator=(const syntax &) = delete;
+
     enum struct arg_type {
         integer,
         label,
@@ -33,8 +49,10 @@ public:
 
     struct arg {
 	arg_type type;
-	std::string str_val;
+	std::pmr::string str_val;//string arguments
 	int64_t int_val;
+	isa::reg_id reg_val = isa::reg_id::LAST;//register arguments, LAST for registers the isa does not have
+	identifier_table::handle label_val = identifier_table::none;//label arguments
     };
     
     enum struct statement_type {
@@ -44,17 +62,17 @@ public:
 
     struct statement {
         statement_type type;
-        std::string label;
-        std::string mnemonic;
-	std::string directive;
-        std::vector<arg> args;
+        identifier_table::handle label = identifier_table::none;
+        asm_lang::inst_statement_info mnemonic;//inst statements
+	asm_lang::directive_info directive;//dir statements
+        std::pmr::vector<arg> args;
     };
 
     std::pair<syntax::statement, bool> parse_statement();
     void parse_file(std::vector<statement> &tree);
 
 private:
-    std::vector<syntax::arg> parse_arguments();
+    void parse_arguments(std::pmr::vector<arg> &args);
     void eat_whitelines(void);
 };
 
@@ -5,6 +5,8 @@
 #ifndef ASSEMBLER_TEMPLATES_H
 #define ASSEMBLER_TEMPLATES_H
 
+#include <array>
+#include <initializer_list>
 #include <string>
 #include <map>
 #include <unordered_map>
@@ -12,31 +14,6 @@
 
 #include "magic_enum/magic_enum.hpp"
 
-template<typename T>
-std::map<std::string, T> enum_to_name_map() {
-    std::map<std::string, T> map;
-    auto pairs = magic_enum::enum_entries<T>();
-
-    for (auto &r: pairs) {
-        map.insert({std::string{r.second}, r.first});
-    }
-
-    return map;
-}
-
-template<typename T>
-bool enum_name_lookup(const std::string &name, T &id) {
-    static auto lookup_map = enum_to_name_map<T>();
-    auto it = lookup_map.find(name);
-
-    if (it == lookup_map.end()) {
-        return false;
-    }
-
-    id = it->second;
-    return true;
-}
-
 template<typename enum_t, typename value_t>
 class enum_lut {
         std::array<value_t, (std::size_t) enum_t::LAST> lut;
@@ -44,12 +21,19 @@ class enum_lut {
 public:
     using iterator = typename std::array<value_t, (std::size_t) enum_t::LAST>::iterator;
 
-    enum_lut(std::vector<std::pair<enum_t, value_t>> lut_arg) {
+    constexpr enum_lut(std::initializer_list<std::pair<enum_t, value_t>> lut_arg) : lut{} {
         assert(lut_arg.size() == (std::size_t) enum_t::LAST);
         for (auto &p: lut_arg)
             lut[(uint) p.first] = p.second;
     };
 
+    //for tables computed from other tables, value_of(id) is called for every enumerator
+    template<typename function_t>
+    constexpr enum_lut(function_t value_of) : lut{} {
+        for (std::size_t i = 0; i < (std::size_t) enum_t::LAST; i++)
+            lut[i] = value_of((enum_t) i);
+    };
+
     const iterator begin() const {
         return (iterator) lut.begin();
     };
@@ -59,12 +43,12 @@ public:
     }
 
 
-    const value_t &operator[](enum_t index) const {
+    constexpr const value_t &operator[](enum_t index) const {
         assert(index < enum_t::LAST);
         return lut[(uint) index];
     }
 
-    const value_t &operator[](int index) const {
+    constexpr const value_t &operator[](int index) const {
         assert(index < (int) enum_t::LAST);
         return lut[index];
     }
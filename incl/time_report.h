@@ -0,0 +1,34 @@
+#ifndef ASSEMBLER_TIME_REPORT_H
+#define ASSEMBLER_TIME_REPORT_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+//wall time per compilation phase and named counters, printed with --time-report
+//only meant to be used from the main thread
+namespace time_report {
+
+void enable();
+bool is_enabled();
+
+void set_counter(const std::string &name, int64_t value);
+void print(std::ostream &strm);
+
+//measures the wall time between construction and destruction
+class phase {
+    std::string name_m;
+    std::chrono::steady_clock::time_point start_m;
+
+public:
+    phase(std::string name);
+    ~phase();
+
+    phase(const phase &) = delete;
+    phase &operator=(const phase &) = delete;
+};
+
+}// namespace time_report
+
+#endif//ASSEMBLER_TIME_REPORT_H
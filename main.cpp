@@ -6,42 +6,60 @@
 #include "semantic_statement.h"
 #include "syntax.h"
 #include "program_options.h"
+#include "preprocessor.h"
+#include "source_buffer.h"
+#include "time_report.h"
 
-#include <boost/filesystem.hpp>
 #include <filesystem>
-#include <boost/interprocess/streams/bufferstream.hpp>
 
-extern "C" int gpp(int argc, char **argv, FILE *output_file, FILE *input_file);
  int main(int argc, char *args[]) {
     auto options = program_options(argc, args);
+    if (options.time_report)
+        time_report::enable();
 
-    //---run gpp preprocessor---//
-    FILE *macro_input = fopen(options.input_fname.c_str(), "r");
-    if(macro_input == nullptr)
-        throw std::runtime_error("could not read input file");
-
-    size_t size;
-    char *ptr;
-    FILE *output_assembly = open_memstream(&ptr, &size);
-    assert(output_assembly);
+    //---map input file---//
+    const auto source = source_buffer::map_file(options.input_fname);
 
-    gpp(1, args + argc - 1, output_assembly, macro_input);
-    boost::interprocess::bufferstream assembly(ptr, size);
-
-    //---compile---//
-    syntax parser((std::fstream *) &assembly); //syntax parser
-    auto compile_unit = semantic_analyzer(parser, options); //semantic_statements analysis
-    binary_generator(options.output_fname, compile_unit); //elf binary generator
+    //---run gpp preprocessor---//
+    //sources without any preprocessor syntax are lexed straight out of the mapping
+    const bool run_pp = options.preprocess && needs_preprocessing(source.view());
+    time_report::set_counter("preprocessor skipped", run_pp ? 0 : 1);
 
+    //---save preprocessor output---//
+    FILE *pp_save_file = nullptr;
     if(options.save_pp_result) {
-        //---save preprocessor output---//
         std::filesystem::path pp_output_path = options.input_fname;
         pp_output_path.replace_extension(".pp.s");
-        FILE *f = fopen(pp_output_path.c_str(), "w");
-        fputs(ptr, f);
-        fclose(f);
+        pp_save_file = fopen(pp_output_path.c_str(), "w");
+        if(pp_save_file == nullptr)
+            throw std::runtime_error("could not write preprocessor output");
     }
 
+    //---compile---//
+    compilation_unit compile_unit;
+    if (run_pp) {
+        //gpp runs on its own thread while its output is being parsed
+        time_report::phase compile_phase("preprocessor, parse and semantic analysis");
+        preprocessor_pipeline pp(args + argc - 1, source, pp_save_file); //output is teed for --savepp
+        syntax parser(pp.output(), options.lexer); //syntax parser
+        compile_unit = semantic_analyzer(parser, options); //semantic_statements analysis
+    } else {
+        time_report::phase compile_phase("parse and semantic analysis");
+        syntax parser(source.view(), options.lexer); //syntax parser
+        compile_unit = semantic_analyzer(parser, options); //semantic_statements analysis
+
+        if (pp_save_file != nullptr)
+            fwrite(source.data(), 1, source.size(), pp_save_file);
+    }
+
+    if (pp_save_file != nullptr)
+        fclose(pp_save_file);
+
+    {
+        time_report::phase binary_phase("binary generation");
+        binary_generator(options.output_fname, compile_unit); //elf binary generator
+    }
+
+    time_report::print(std::cerr);
     return 0;
 }
-
@@ -5,23 +5,47 @@
 #include "binary_generator.h"
 #include "compilation_unit_t.h"
 #include "elf_generator.h"
+#include "time_report.h"
+
+//bytes elf_generator stores for a data section: its final size, the same count semantic analysis
+//placed its symbols with, without the zero runs that are left out
+static uint32_t stored_size(const std::vector<binary_data::data_alloc_t> &allocs) {
+    binary_data::alligned_counter counter;
+    uint32_t nzero_run_bytes = 0;
+    for (const auto &data_alloc: allocs) {
+        counter.increment(data_alloc.memory_alloc);
+        if (data_alloc.zero_data && data_alloc.memory_alloc.nbytes >= elf_generator::min_zero_run)
+            nzero_run_bytes += data_alloc.memory_alloc.nbytes;
+    }
+    return counter.get_count() - nzero_run_bytes;
+}
 
 void binary_generator(const std::string &fname, compilation_unit &comp_unit) {
 
     elf_generator elf(fname);
 
-    //---insert instructions---//
+    //---insert machine code---//
     elf.set_text_section();
-    for (auto &inst: comp_unit.instructions) elf.push_instruction(inst);
+    elf.push_bytes(comp_unit.text.data(), comp_unit.text.size());
+
+    if (time_report::is_enabled()) {
+        int64_t nstmnt_bytes = 0;
+        for (const auto &entry: comp_unit.text_layout) nstmnt_bytes += entry.nbytes;
+        time_report::set_counter("text statements", (int64_t) comp_unit.text_layout.size());
+        time_report::set_counter("text padding bytes", (int64_t) comp_unit.text.size() - nstmnt_bytes);
+    }
 
     //---insert data sections---//
     elf.set_data_section();
+    elf.reserve(stored_size(comp_unit.data));
     for (auto &data_alloc: comp_unit.data) elf.push_data(data_alloc);
 
     elf.set_rodata_section();
+    elf.reserve(stored_size(comp_unit.rodata));
     for (auto &data_alloc: comp_unit.rodata) elf.push_data(data_alloc);
 
     elf.set_bss_section();
+    //.bss only has a size
     for (auto &data_alloc: comp_unit.bss)
         elf.push_zero_alloc(data_alloc.memory_alloc);
 
@@ -29,16 +53,26 @@ void binary_generator(const std::string &fname, compilation_unit &comp_unit) {
     for (auto &sym : comp_unit.st) elf.insert_symbol_def(sym);
 
     //---insert relocs---//
-    for (auto &sym_ref: comp_unit.st.get_ref_data())
-        elf.insert_symbol_ref(sym_ref);
+    for (auto &sym_ref: comp_unit.st.get_ref_data()) {
+        //section relative references already hold the final address in an executable layout
+        const bool is_resolved = comp_unit.exec_addresses &&
+                                 (sym_ref.type == binary::reloc_type::secr_long_load ||
+                                  sym_ref.type == binary::reloc_type::secr_long_store);
+        if (!is_resolved) elf.insert_symbol_ref(sym_ref);
+    }
 
     //---set entry point---//
     bool found_symbol = false;
-    const auto sym_id = comp_unit.st.get_id("start", found_symbol);
+    identifier_table::handle start_identifier;
+    int32_t sym_id = 0;
+    if (identifiers().find("start", start_identifier))
+        sym_id = comp_unit.st.get_id(start_identifier, found_symbol);
     if (found_symbol == true && sym_id != 0)
         elf.set_entrypoint(comp_unit.st[sym_id].address);
     else
         elf.set_entrypoint(0);
 
+    if (comp_unit.exec_addresses) elf.set_exec_layout(*comp_unit.exec_addresses);
+
     elf.write();
 }
\ No newline at end of file
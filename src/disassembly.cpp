@@ -0,0 +1,310 @@
+#include "disassembly.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+#include "binary.h"
+#include "parallel.h"
+
+//---listing_buffer---//
+listing_buffer::listing_buffer(FILE *output) : output_m(output), block_m(block_size) {
+    pos_m = line_m = block_m.data();
+}
+
+void listing_buffer::make_room(std::size_t n) {
+    if (output_m != nullptr) {
+        flush();
+        return;
+    }
+
+    const std::size_t used = pos_m - block_m.data();
+    const std::size_t line = line_m - block_m.data();
+    block_m.resize(std::max(block_m.size() * 2, used + n));
+    pos_m = block_m.data() + used;
+    line_m = block_m.data() + line;
+}
+
+//too long for what is left of the block, written out directly
+void listing_buffer::append_long(std::string_view str) {
+    if (output_m == nullptr) {
+        make_room(str.size());
+        std::memcpy(pos_m, str.data(), str.size());
+        pos_m += str.size();
+        return;
+    }
+
+    flush();
+    fwrite(str.data(), 1, str.size(), output_m);
+    nwritten_m += str.size();
+}
+
+void listing_buffer::append_hex(uint32_t val, int ndigits) {
+    static const char digits[] = "0123456789abcdef";
+    for (int i = ndigits - 1; i >= 0; i--) {
+        pos_m[i] = digits[val & 0xf];
+        val >>= 4;
+    }
+    pos_m += ndigits;
+}
+
+void listing_buffer::append_decimal(int64_t val) {
+    pos_m = std::to_chars(pos_m, pos_m + 24, val).ptr;
+}
+
+void listing_buffer::pad_to(std::size_t column) {
+    const std::size_t line_size = pos_m - line_m;
+    if (line_size >= column) {
+        append(' ');
+        return;
+    }
+
+    std::memset(pos_m, ' ', column - line_size);
+    pos_m += column - line_size;
+}
+
+void listing_buffer::flush() {
+    if (output_m == nullptr) return;
+
+    if (pos_m != block_m.data()) fwrite(block_m.data(), 1, pos_m - block_m.data(), output_m);
+    nwritten_m += pos_m - block_m.data();
+    pos_m = line_m = block_m.data();
+}
+
+//---disassembly---//
+namespace {
+
+const std::size_t chunk_size = 1 << 14;
+
+struct text_symbol {
+    uint32_t address;
+    std::string_view name;
+};
+
+//instruction text like isa::instruction::to_str, without building a string
+void append_instruction(listing_buffer &out, const isa::instruction &inst) {
+    using isa::reg_id;
+
+    if (inst.id == isa::inst_id::INVALID) {
+        out.append("NOT DEFINED");
+        return;
+    }
+
+    if (inst.id == isa::inst_id::Add_h && inst.dr == reg_id::zero && inst.sr1 == reg_id::zero &&
+        inst.sr2 == reg_id::zero) {
+        out.append("NOP");
+        return;
+    }
+
+    const auto operand_form = isa::format_operand_form_lut[inst.format];
+    out.append(isa::inst_id_to_string(inst.id));
+
+    char separator = ' ';
+    const auto append_operand_reg = [&](reg_id reg) {
+        if (separator == ',') out.append(',');
+        out.append(' ');
+        out.append(isa::reg_id_to_string(reg));
+        separator = ',';
+    };
+
+    if (operand_form.dr) append_operand_reg(inst.dr);
+    if (operand_form.sr1) append_operand_reg(inst.sr1);
+    if (operand_form.sr2) append_operand_reg(inst.sr2);
+
+    if (operand_form.imm) {
+        if (separator == ',') out.append(',');
+        out.append(' ');
+        out.append_decimal(inst.immediate);
+    }
+}
+
+bool is_pc_relative(const isa::instruction &inst) {
+    return inst.format == isa::format_id::jump ||
+           (inst.format == isa::format_id::branch && isa::is_store_inst(inst.id) == false);
+}
+
+//symbol at or before address as "<name+0x..>", nothing when there is none
+void append_symbolized(listing_buffer &out, const std::vector<text_symbol> &symbols,
+                       uint32_t address) {
+    auto it = std::upper_bound(symbols.begin(), symbols.end(), address,
+                               [](uint32_t addr, const text_symbol &sym) { return addr < sym.address; });
+    if (it == symbols.begin()) return;
+    --it;
+
+    out.append(" <");
+    out.append(it->name);
+    if (address != it->address) {
+        const uint32_t offset = address - it->address;
+        out.append("+0x");
+        out.append_hex(offset, std::max(1, ((int) std::bit_width(offset) + 3) / 4));
+    }
+    out.append('>');
+}
+
+//what every chunk is formatted against, shared read only by the workers
+struct text_listing {
+    std::span<const uint8_t> text;
+    std::vector<std::string_view> symbol_names;
+    std::vector<text_symbol> symbols;//defined in .text, sorted by address
+    std::vector<ELFIO::Elf32_Rel> relocations;//of .text, sorted by address
+};
+
+//the address of the last instruction before chunk_start, chunks start at multiples of 4 so it
+//is either the fullword at chunk_start - 4 or the halfword at chunk_start - 2
+uint32_t last_address_before(std::span<const uint8_t> text, std::size_t chunk_start) {
+    return (text[chunk_start - 4] & 1) != 0 ? chunk_start - 4 : chunk_start - 2;
+}
+
+//decodes and formats the chunk at chunk_start, exactly what a sequential pass over the whole
+//section writes for it. Returns the number of instructions
+std::size_t format_chunk(const text_listing &listing, std::size_t chunk_start, listing_buffer &out,
+                         std::vector<isa::located_instruction> &instructions) {
+    const auto &text = listing.text;
+    const auto &symbols = listing.symbols;
+    const auto &relocations = listing.relocations;
+
+    instructions.clear();
+    isa::decode_many(text.subspan(chunk_start, std::min(chunk_size, text.size() - chunk_start)),
+                     instructions);
+
+    //labels between the last instruction of the previous chunk and the first of this one
+    //are written before the first one
+    auto symbol_it = symbols.begin();
+    if (chunk_start != 0) {
+        symbol_it = std::upper_bound(
+                symbols.begin(), symbols.end(), last_address_before(text, chunk_start),
+                [](uint32_t addr, const text_symbol &sym) { return addr < sym.address; });
+    }
+    auto relocation_it = std::lower_bound(
+            relocations.begin(), relocations.end(), chunk_start,
+            [](const ELFIO::Elf32_Rel &rel, std::size_t addr) { return rel.r_offset < addr; });
+
+    for (const auto &located: instructions) {
+        const uint32_t address = chunk_start + located.address;
+        const isa::instruction &inst = located.inst;
+
+        //---labels---//
+        for (; symbol_it != symbols.end() && symbol_it->address <= address; ++symbol_it) {
+            out.begin_line();
+            out.append('\n');
+            out.append_hex(symbol_it->address, 8);
+            out.append(" <");
+            out.append(symbol_it->name);
+            out.append(">:\n");
+        }
+
+        //---address, encoding and instruction---//
+        out.begin_line();
+        out.append("  ");
+        out.append_hex(address, 8);
+        out.append(":  ");
+
+        const uint8_t *bytes = text.data() + address;
+        if (located.size == isa::instruction_size_type::halfword) {
+            out.append_hex(bytes[0] | bytes[1] << 8, 4);
+            out.append("    ");
+        } else {
+            out.append_hex(bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t) bytes[3] << 24,
+                           8);
+        }
+        out.append("  ");
+        append_instruction(out, inst);
+
+        if (inst.id != isa::inst_id::INVALID && is_pc_relative(inst))
+            append_symbolized(out, symbols, address + inst.immediate);
+
+        //---relocations---//
+        while (relocation_it != relocations.end() && relocation_it->r_offset < address)
+            ++relocation_it;
+
+        for (; relocation_it != relocations.end() && relocation_it->r_offset == address;
+             ++relocation_it) {
+            const auto type = (binary::reloc_type) ELF32_R_TYPE(relocation_it->r_info);
+            const auto symbol_index = ELF32_R_SYM(relocation_it->r_info);
+
+            out.pad_to(48);
+            out.append("; ");
+            out.append(magic_enum::enum_name(type));
+            if (symbol_index < listing.symbol_names.size()) {
+                out.append(' ');
+                out.append(listing.symbol_names[symbol_index]);
+            }
+        }
+
+        out.append('\n');
+    }
+
+    return instructions.size();
+}
+
+//a chunk formatted on a worker thread, kept until the chunks before it are written out
+struct formatted_chunk {
+    listing_buffer listing;
+    std::vector<isa::located_instruction> instructions;
+    std::size_t ninstructions = 0;
+};
+
+}// namespace
+
+std::size_t disassemble_text(const elf_image &image, listing_buffer &out, unsigned njobs) {
+    const ELFIO::Elf32_Shdr *text_section = image.find_section(".text");
+    if (text_section == nullptr) throw std::runtime_error("no .text section");
+    const std::size_t text_index = image.section_index(*text_section);
+
+    text_listing listing;
+    listing.text = image.section_data(*text_section);
+
+    //---symbol names, looked up once instead of for every relocation---//
+    const auto all_symbols = image.symbols();
+    listing.symbol_names.reserve(all_symbols.size());
+    for (const auto &sym: all_symbols) listing.symbol_names.push_back(image.symbol_name(sym));
+
+    //---symbols defined in .text, sorted by address---//
+    for (std::size_t i = 0; i < all_symbols.size(); i++)
+        if (all_symbols[i].st_shndx == text_index && all_symbols[i].st_name != 0)
+            listing.symbols.push_back({all_symbols[i].st_value, listing.symbol_names[i]});
+    std::stable_sort(
+            listing.symbols.begin(), listing.symbols.end(),
+            [](const text_symbol &a, const text_symbol &b) { return a.address < b.address; });
+
+    //---relocations of .text, sorted by address---//
+    const auto relocation_entries = image.relocations(*text_section);
+    listing.relocations.assign(relocation_entries.begin(), relocation_entries.end());
+    std::stable_sort(listing.relocations.begin(), listing.relocations.end(),
+                     [](const auto &a, const auto &b) { return a.r_offset < b.r_offset; });
+
+    //---decode and format chunk by chunk---//
+    //chunks start at multiples of 4, so no instruction crosses a chunk boundary and the
+    //decoded instructions of a chunk stay in cache while they are formatted
+    const std::size_t nchunks = (listing.text.size() + chunk_size - 1) / chunk_size;
+    std::size_t ninstructions = 0;
+
+    if (njobs <= 1) {
+        std::vector<isa::located_instruction> instructions;
+        for (std::size_t chunk = 0; chunk < nchunks; chunk++)
+            ninstructions += format_chunk(listing, chunk * chunk_size, out, instructions);
+        return ninstructions;
+    }
+
+    //a few chunks per thread at a time, formatted in parallel and written out in order
+    std::vector<formatted_chunk> batch(std::min<std::size_t>(nchunks, (std::size_t) njobs * 4));
+    for (std::size_t first = 0; first < nchunks; first += batch.size()) {
+        const std::size_t nbatch = std::min(batch.size(), nchunks - first);
+
+        parallel_for(nbatch, njobs, [&](std::size_t i) {
+            formatted_chunk &chunk = batch[i];
+            chunk.listing.clear();
+            chunk.ninstructions = format_chunk(listing, (first + i) * chunk_size, chunk.listing,
+                                               chunk.instructions);
+        });
+
+        for (std::size_t i = 0; i < nbatch; i++) {
+            out.append(batch[i].listing.view());
+            ninstructions += batch[i].ninstructions;
+        }
+    }
+
+    return ninstructions;
+}
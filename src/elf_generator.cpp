@@ -1,77 +1,250 @@
 //
 // Created by djordy on 12/25/22.
 //
-#include "elfio/elfio.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "elfio/elf_types.hpp"
 #include "binary_data.h"
 #include "symbol_table.h"
 #include "isa.h"
 
 #include "elf_generator.h"
-void elf_generator::initialise() {
-    //set 32 bit and little endian 2s compliment
-    writer.create(ELFIO::ELFCLASS32, ELFIO::ELFDATA2LSB);
-
-    //not a known platform
-    writer.set_os_abi(ELFIO::ELFOSABI_STANDALONE);
-    writer.set_machine(ELFIO::EM_NONE);
-
-    //executable elf
-    writer.set_type(ELFIO::ET_EXEC);
-
-    /*---text section--*/
-    text_sec = writer.sections.add(".text");
-    text_sec->set_type(ELFIO::SHT_PROGBITS);//set section type to program data
-    text_sec->set_flags(
-            ELFIO::SHF_EXECINSTR |//executable section
-            ELFIO::SHF_ALLOC);//section needs to be allocated in memory during execution
-
-    text_sec->set_addr_align(4);//set allignment to 4 bytes (word)
-
-    /*---data section--*/
-    data_sec = writer.sections.add(".data");
-    data_sec->set_type(ELFIO::SHT_PROGBITS);//set section type to program data
-    data_sec->set_flags(
-            ELFIO::SHF_WRITE//writable data
-            |
-            ELFIO::SHF_ALLOC);//section needs to be allocated in memory during execution
-    data_sec->set_addr_align(4);//set allignment to 4 bytes (word)
-
-    /*---bss section---*/
-    bss_sec = writer.sections.add(".bss");
-    bss_sec->set_type(ELFIO::SHT_NOBITS);// Program space with no data
-    bss_sec->set_flags(
-            ELFIO::SHF_WRITE |//writable data
-            ELFIO::SHF_ALLOC);//section needs to be allocated in memory during execution
-    bss_sec->set_addr_align(4);//set allignment to 4 bytes (word)
-
-
-    /*---rodata section--*/
-    rodata_sec = writer.sections.add(".rodata");
-    rodata_sec->set_type(ELFIO::SHT_PROGBITS);//set section type to program data
-    rodata_sec->set_flags(
-            ELFIO::SHF_ALLOC);//section needs to be allocated in memory during execution
-    rodata_sec->set_addr_align(4);//set allignment to 4 bytes (word)
-
-
-    //---string section---*/
-    str_sec = writer.sections.add(".strtab");
-    str_sec->set_type(ELFIO::SHT_STRTAB);
-
-    //---symbtab section---//
-    sym_sec = writer.sections.add(".symtab");
-    sym_sec->set_type(ELFIO::SHT_SYMTAB); //set symbol table type
-    sym_sec->set_addr_align( 0x4 ); //set allignment to 4 bytes (word)
-    sym_sec->set_entry_size(writer.get_default_entry_size( ELFIO::SHT_SYMTAB ) );
-    sym_sec->set_link( str_sec->get_index() ); //link to the string table
-
-    //---reloc section--//
-    // for symbolic references
-    rel_sec = writer.sections.add(".rel"); //relocates for the text section
-    rel_sec->set_type(ELFIO::SHT_REL); //relocate table type
-    rel_sec->set_info(text_sec->get_index()); //in context of text section
-    rel_sec->set_addr_align( 0x4 ); //set allignment to 4 bytes (word)
-    rel_sec->set_entry_size(writer.get_default_entry_size( ELFIO::SHT_REL));
-    rel_sec->set_link( sym_sec->get_index() ); //link to symbol table section
+
+//---section header table---//
+//the order is fixed, the indices are the ones symbols and relocations refer to
+namespace {
+    enum section_index : ELFIO::Elf_Half {
+        null_index,
+        shstrtab_index,
+        text_index,
+        data_index,
+        bss_index,
+        rodata_index,
+        strtab_index,
+        symtab_index,
+        rel_index,
+        nsections,
+    };
+
+    constexpr char shstrtab[] = "\0.shstrtab\0.text\0.data\0.bss\0.rodata\0.strtab\0.symtab\0.rel";
+
+    //offset of the name that follows "\0" + previous in shstrtab
+    constexpr ELFIO::Elf_Word name_after(ELFIO::Elf_Word previous_offset, const char *previous) {
+        return previous_offset + std::char_traits<char>::length(previous) + 1;
+    }
+
+    struct section_desc {
+        ELFIO::Elf_Word name;
+        ELFIO::Elf_Word type;
+        ELFIO::Elf_Word flags;
+        ELFIO::Elf_Word link;
+        ELFIO::Elf_Word info;
+        ELFIO::Elf_Word addralign;
+        ELFIO::Elf_Word entsize;
+    };
+
+    constexpr ELFIO::Elf_Word shstrtab_name = 1;
+    constexpr ELFIO::Elf_Word text_name = name_after(shstrtab_name, ".shstrtab");
+    constexpr ELFIO::Elf_Word data_name = name_after(text_name, ".text");
+    constexpr ELFIO::Elf_Word bss_name = name_after(data_name, ".data");
+    constexpr ELFIO::Elf_Word rodata_name = name_after(bss_name, ".bss");
+    constexpr ELFIO::Elf_Word strtab_name = name_after(rodata_name, ".rodata");
+    constexpr ELFIO::Elf_Word symtab_name = name_after(strtab_name, ".strtab");
+    constexpr ELFIO::Elf_Word rel_name = name_after(symtab_name, ".symtab");
+
+    //the file is little endian, a big endian host swaps everything it writes
+    constexpr bool swap_bytes = std::endian::native == std::endian::big;
+
+    template<typename word_t>
+    word_t to_little_endian(word_t val) {
+        if constexpr (swap_bytes)
+            return std::byteswap(val);
+        else
+            return val;
+    }
+
+    //stores values as little endian word_t's, truncating them like a cast would.
+    //On a little endian host a run of words is a plain copy
+    template<typename word_t>
+    void store_values(char *out, std::span<const int32_t> values) {
+        if constexpr (sizeof(word_t) == sizeof(int32_t) && !swap_bytes) {
+            std::memcpy(out, values.data(), values.size_bytes());
+        } else {
+            for (const auto val: values) {
+                const auto word = to_little_endian(static_cast<word_t>(val));
+                std::memcpy(out, &word, sizeof(word));
+                out += sizeof(word);
+            }
+        }
+    }
+
+    //---elf structures in file byte order---//
+    //headers and table entries are built in host order and copied into the file as they are
+    //laid out in memory, only a big endian host has to swap their fields first
+    template<typename... fields_t>
+    void swap_fields(fields_t &...fields) {
+        ((fields = std::byteswap(fields)), ...);
+    }
+
+    void swap_entry(ELFIO::Elf32_Ehdr &h) {
+        swap_fields(h.e_type, h.e_machine, h.e_version, h.e_entry, h.e_phoff, h.e_shoff, h.e_flags,
+                    h.e_ehsize, h.e_phentsize, h.e_phnum, h.e_shentsize, h.e_shnum, h.e_shstrndx);
+    }
+
+    void swap_entry(ELFIO::Elf32_Phdr &ph) {
+        swap_fields(ph.p_type, ph.p_offset, ph.p_vaddr, ph.p_paddr, ph.p_filesz, ph.p_memsz,
+                    ph.p_flags, ph.p_align);
+    }
+
+    void swap_entry(ELFIO::Elf32_Shdr &sh) {
+        swap_fields(sh.sh_name, sh.sh_type, sh.sh_flags, sh.sh_addr, sh.sh_offset, sh.sh_size,
+                    sh.sh_link, sh.sh_info, sh.sh_addralign, sh.sh_entsize);
+    }
+
+    void swap_entry(ELFIO::Elf32_Sym &sym) {
+        swap_fields(sym.st_name, sym.st_value, sym.st_size, sym.st_shndx);
+    }
+
+    void swap_entry(ELFIO::Elf32_Rel &rel) {
+        swap_fields(rel.r_offset, rel.r_info);
+    }
+
+    //entries as they go into the file, the same storage on a little endian host
+    template<typename entry_t>
+    std::span<const entry_t> in_file_order(std::span<const entry_t> entries,
+                                           std::vector<entry_t> &swapped) {
+        if constexpr (!swap_bytes) {
+            return entries;
+        } else {
+            swapped.assign(entries.begin(), entries.end());
+            for (auto &entry: swapped) swap_entry(entry);
+            return swapped;
+        }
+    }
+
+    constexpr std::array<section_desc, nsections> section_descs = {{
+            {0, ELFIO::SHT_NULL, 0, 0, 0, 0, 0},
+            {shstrtab_name, ELFIO::SHT_STRTAB, 0, 0, 0, 1, 0},
+            //executable code, allocated in memory during execution
+            {text_name, ELFIO::SHT_PROGBITS, ELFIO::SHF_EXECINSTR | ELFIO::SHF_ALLOC, 0, 0, 4, 0},
+            //writable data
+            {data_name, ELFIO::SHT_PROGBITS, ELFIO::SHF_WRITE | ELFIO::SHF_ALLOC, 0, 0, 4, 0},
+            //program space with no data
+            {bss_name, ELFIO::SHT_NOBITS, ELFIO::SHF_WRITE | ELFIO::SHF_ALLOC, 0, 0, 4, 0},
+            {rodata_name, ELFIO::SHT_PROGBITS, ELFIO::SHF_ALLOC, 0, 0, 4, 0},
+            {strtab_name, ELFIO::SHT_STRTAB, 0, 0, 0, 0, 0},
+            //names in .strtab
+            {symtab_name, ELFIO::SHT_SYMTAB, 0, strtab_index, 0, 4, sizeof(ELFIO::Elf32_Sym)},
+            //symbolic references in .text to symbols in .symtab
+            {rel_name, ELFIO::SHT_REL, 0, symtab_index, text_index, 4, sizeof(ELFIO::Elf32_Rel)},
+    }};
+}
+
+//---section buffer---//
+char *elf_generator::section_buffer::grow(std::size_t nbytes) {
+    assert(!nobits_m);
+    const std::size_t old_size = bytes_m.size();
+    bytes_m.resize(old_size + nbytes, 0);
+    size_m += nbytes;
+    return bytes_m.data() + old_size;
+}
+
+void elf_generator::section_buffer::push_zeros(std::size_t nbytes) {
+    if (nobits_m) {
+        size_m += nbytes;
+    } else if (nbytes < min_zero_run) {
+        //short runs and padding are cheaper stored than tracked
+        grow(nbytes);
+    } else if (!zero_runs_m.empty() && zero_runs_m.back().offset + zero_runs_m.back().nbytes == size_m) {
+        zero_runs_m.back().nbytes += nbytes;
+        size_m += nbytes;
+    } else {
+        zero_runs_m.push_back({.offset = size_m, .nbytes = (uint32_t) nbytes});
+        size_m += nbytes;
+    }
+}
+
+//---output file---//
+//regular files skip the gaps with lseek, so alignment padding and zero runs become holes.
+//anything else (pipes, /dev/null, terminals) can't seek and gets the gaps as written zeros
+class elf_generator::output_file {
+    int fd_m;
+    bool seekable_m = false;
+    off_t pos_m = 0;
+
+public:
+    explicit output_file(const std::string &fname)
+        : fd_m(open(fname.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666)) {
+        struct stat st{};
+        if (fd_m < 0 || fstat(fd_m, &st) != 0) fail();
+        seekable_m = S_ISREG(st.st_mode);
+    }
+    output_file(const output_file &) = delete;
+    output_file &operator=(const output_file &) = delete;
+    ~output_file() { if (fd_m >= 0) ::close(fd_m); }
+
+    off_t pos() const { return pos_m; }
+
+    //short writes are continued, a write that makes no progress is an error
+    void write(const void *bytes, std::size_t nbytes) {
+        const char *in = static_cast<const char *>(bytes);
+        while (nbytes != 0) {
+            const ssize_t written = ::write(fd_m, in, nbytes);
+            if (written < 0 && errno == EINTR) continue;
+            if (written <= 0) fail();
+            in += written;
+            nbytes -= written;
+            pos_m += written;
+        }
+    }
+
+    void skip_to(off_t offset) {
+        assert(offset >= pos_m);
+        if (seekable_m) {
+            if (offset != pos_m && lseek(fd_m, offset, SEEK_SET) != offset) fail();
+            pos_m = offset;
+            return;
+        }
+
+        static constexpr std::array<char, 4096> zeros{};
+        while (pos_m < offset) write(zeros.data(), std::min<off_t>(offset - pos_m, zeros.size()));
+    }
+
+    //close reports deferred write errors (nfs, quota), so it is checked too
+    void close() {
+        const int fd = fd_m;
+        fd_m = -1;
+        if (::close(fd) != 0) fail();
+    }
+
+private:
+    [[noreturn]] static void fail() { throw std::runtime_error("could not write output file"); }
+};
+
+void elf_generator::section_buffer::write_to(output_file &out) const {
+    if (nobits_m) return;
+
+    //stored bytes are written between the runs, the runs themselves are skipped
+    const char *in = bytes_m.data();
+    const off_t start = out.pos();
+    uint32_t offset = 0;
+    for (const auto &run: zero_runs_m) {
+        out.write(in, run.offset - offset);
+        in += run.offset - offset;
+        offset = run.offset + run.nbytes;
+        out.skip_to(start + offset);
+    }
+    out.write(in, size_m - offset);
 }
 
 void elf_generator::set_data_section() {
@@ -90,7 +263,7 @@ void elf_generator::set_rodata_section() {
     working_section = section_t::rodata;
 }
 
-std::string &elf_generator::get_working_data() {
+elf_generator::section_buffer &elf_generator::get_working_data() {
     switch (working_section) {
         case section_t::text:
             return text;
@@ -105,63 +278,189 @@ std::string &elf_generator::get_working_data() {
     }
 }
 
-uint32_t elf_generator::push_instruction(const isa::instruction &inst) {
-    auto encoded = inst.encode();
-
-    uint32_t address;
-
-    if (encoded.size == isa::instruction_size_type::halfword) {
-        address = push_data(static_cast<uint16_t>(encoded.halfword));
-    } else if (encoded.size == isa::instruction_size_type::fullword) {
-        address = push_data(static_cast<uint32_t>(encoded.fullword));
-    }
-
-    return address;
+//appends already encoded bytes without alignment
+uint32_t elf_generator::push_bytes(const uint8_t *bytes, std::size_t nbytes) {
+    auto &working_data = get_working_data();
+    const uint32_t placement_address = working_data.size();
+    std::memcpy(working_data.grow(nbytes), bytes, nbytes);
+    return placement_address;
 }
 
+//lays out the whole file from the section sizes and writes it front to back.
+//Sections follow the elf header and program header table in index order, each at its alignment,
+//the section header table comes last. Alignment gaps and the zero runs of sections are
+//seeked over in a regular file and stay holes
 void elf_generator::write() {
-    //load text section
-    text_sec->set_data(text.c_str(), text.size()); //load text section data
-
-    //load rodata section
-    rodata_sec->set_data(rodata.c_str(), rodata.size());
-
-    //load data section
-    data_sec->set_data(data.c_str(), data.size());
+    struct section_contents {
+        const section_buffer *buffer;//program sections
+        const void *bytes;//tables
+        std::size_t nbytes;
+    };
+
+    std::vector<ELFIO::Elf32_Sym> swapped_symtab;
+    std::vector<ELFIO::Elf32_Rel> swapped_reltab;
+    const auto file_symtab = in_file_order<ELFIO::Elf32_Sym>(symtab, swapped_symtab);
+    const auto file_reltab = in_file_order<ELFIO::Elf32_Rel>(reltab, swapped_reltab);
+
+    const std::array<section_contents, nsections> contents = {{
+            {nullptr, nullptr, 0},
+            {nullptr, shstrtab, sizeof(shstrtab)},
+            {&text, nullptr, text.size()},
+            {&data, nullptr, data.size()},
+            {&bss, nullptr, bss.size()},
+            {&rodata, nullptr, rodata.size()},
+            {nullptr, strtab.data(), strtab.size()},
+            {nullptr, file_symtab.data(), file_symtab.size_bytes()},
+            {nullptr, file_reltab.data(), file_reltab.size_bytes()},
+    }};
+
+    //---load segments---//
+    //in an executable layout: .text, .rodata and .data with .bss, the empty ones are left out.
+    //segment_sizes holds the memory size of the segment a section starts, 0 for all others
+    std::array<ELFIO::Elf32_Addr, nsections> addresses{};
+    std::array<ELFIO::Elf_Word, nsections> segment_sizes{};
+    if (exec_addresses) {
+        addresses[text_index] = exec_addresses->text;
+        addresses[rodata_index] = exec_addresses->rodata;
+        addresses[data_index] = exec_addresses->data;
+        addresses[bss_index] = exec_addresses->bss;
+        assert(exec_addresses->bss >= exec_addresses->data + data.size());
+
+        segment_sizes[text_index] = text.size();
+        segment_sizes[rodata_index] = rodata.size();
+        //the part past .data is zero filled by the loader
+        segment_sizes[data_index] = exec_addresses->bss + bss.size() - exec_addresses->data;
+    }
+    const std::size_t nsegments =
+            std::ranges::count_if(segment_sizes, [](ELFIO::Elf_Word memsz) { return memsz != 0; });
+
+    //---layout---//
+    std::array<ELFIO::Elf32_Shdr, nsections> section_headers{};
+    std::size_t file_pos = sizeof(ELFIO::Elf32_Ehdr) + nsegments * sizeof(ELFIO::Elf32_Phdr);
+    for (std::size_t i = 0; i < nsections; i++) {
+        const auto &desc = section_descs[i];
+        auto &sh = section_headers[i];
+
+        //a section starting a segment starts on a page, even when only its .bss part is in memory,
+        //so the segment offset and address agree modulo the page size
+        const bool starts_segment = segment_sizes[i] != 0;
+        const ELFIO::Elf_Word file_allign = starts_segment ? binary::page_size : desc.addralign;
+        if (file_allign > 1) file_pos = (file_pos + file_allign - 1) / file_allign * file_allign;
+
+        //an empty program section outside the segments is put at offset 0, inside the elf header,
+        //so it can't share its offset with a segment and be counted into it
+        const bool is_unmapped = exec_addresses && (desc.flags & ELFIO::SHF_ALLOC) != 0 &&
+                                 contents[i].nbytes == 0 && !starts_segment;
+
+        sh.sh_name = desc.name;
+        sh.sh_type = desc.type;
+        sh.sh_flags = desc.flags;
+        sh.sh_addr = addresses[i];
+        sh.sh_offset = i == null_index || is_unmapped ? 0 : file_pos;
+        sh.sh_size = contents[i].nbytes;
+        sh.sh_link = desc.link;
+        sh.sh_info = desc.info;
+        sh.sh_addralign = desc.addralign;
+        sh.sh_entsize = desc.entsize;
+
+        if (desc.type != ELFIO::SHT_NOBITS && desc.type != ELFIO::SHT_NULL) file_pos += contents[i].nbytes;
+    }
 
-    //load bss section
-    bss_sec->set_size(bss.size());
+    const std::size_t section_table_offset = (file_pos + 3) / 4 * 4;
+    [[maybe_unused]] const std::size_t file_size = section_table_offset + sizeof(section_headers);
+
+    std::vector<ELFIO::Elf32_Phdr> segments;
+    segments.reserve(nsegments);
+    const auto push_segment = [&](section_index first, ELFIO::Elf_Word flags) {
+        const auto &sh = section_headers[first];
+        const ELFIO::Elf_Word memsz = segment_sizes[first];
+        if (memsz == 0) return;
+
+        segments.push_back({.p_type = ELFIO::PT_LOAD,
+                            .p_offset = sh.sh_offset,
+                            .p_vaddr = sh.sh_addr,
+                            .p_paddr = sh.sh_addr,
+                            .p_filesz = sh.sh_size,
+                            .p_memsz = memsz,
+                            .p_flags = flags,
+                            .p_align = binary::page_size});
+    };
+
+    push_segment(text_index, ELFIO::PF_R | ELFIO::PF_X);
+    push_segment(rodata_index, ELFIO::PF_R);
+    push_segment(data_index, ELFIO::PF_R | ELFIO::PF_W);
+    assert(segments.size() == nsegments);
+
+    //---elf header---//
+    ELFIO::Elf32_Ehdr header{};
+    header.e_ident[ELFIO::EI_MAG0] = ELFIO::ELFMAG0;
+    header.e_ident[ELFIO::EI_MAG1] = ELFIO::ELFMAG1;
+    header.e_ident[ELFIO::EI_MAG2] = ELFIO::ELFMAG2;
+    header.e_ident[ELFIO::EI_MAG3] = ELFIO::ELFMAG3;
+    header.e_ident[ELFIO::EI_CLASS] = ELFIO::ELFCLASS32;
+    header.e_ident[ELFIO::EI_DATA] = ELFIO::ELFDATA2LSB;//little endian 2s compliment
+    header.e_ident[ELFIO::EI_VERSION] = ELFIO::EV_CURRENT;
+    header.e_ident[ELFIO::EI_OSABI] = ELFIO::ELFOSABI_STANDALONE;//not a known platform
+    header.e_type = ELFIO::ET_EXEC;
+    header.e_machine = ELFIO::EM_NONE;
+    header.e_version = ELFIO::EV_CURRENT;
+    header.e_entry = entry_point;
+    header.e_phoff = nsegments != 0 ? sizeof(ELFIO::Elf32_Ehdr) : 0;
+    header.e_shoff = section_table_offset;
+    header.e_ehsize = sizeof(ELFIO::Elf32_Ehdr);
+    header.e_phentsize = sizeof(ELFIO::Elf32_Phdr);
+    header.e_phnum = nsegments;
+    header.e_shentsize = sizeof(ELFIO::Elf32_Shdr);
+    header.e_shnum = nsections;
+    header.e_shstrndx = shstrtab_index;
+
+    if constexpr (swap_bytes) {
+        swap_entry(header);
+        for (auto &segment: segments) swap_entry(segment);
+    }
 
     //---write file---//
-    writer.set_entry(entry_point);
-    writer.save(output_fname);
+    //everything is written in file order, the section offsets grow with the section index
+    output_file out(output_fname);
+    out.write(&header, sizeof(header));
+    if (nsegments != 0)
+        out.write(segments.data(), nsegments * sizeof(ELFIO::Elf32_Phdr));
+    for (std::size_t i = 0; i < nsections; i++) {
+        if (section_descs[i].type == ELFIO::SHT_NOBITS || contents[i].nbytes == 0) continue;
+
+        out.skip_to((off_t) section_headers[i].sh_offset);
+        if (contents[i].buffer != nullptr)
+            contents[i].buffer->write_to(out);
+        else
+            out.write(contents[i].bytes, contents[i].nbytes);
+    }
+    out.skip_to((off_t) section_table_offset);
+    if constexpr (swap_bytes)
+        for (auto &sh: section_headers) swap_entry(sh);
+    out.write(section_headers.data(), sizeof(section_headers));
+    assert((std::size_t) out.pos() == file_size);
+    out.close();
 }
 
 uint32_t elf_generator::push_data(const binary_data::data_alloc_t &data_alloc) {
     if(data_alloc.zero_data)
         return push_zero_alloc(data_alloc.memory_alloc);
 
-    auto &working_data = get_working_data();
-
     //---align data---//
     const auto placement_address = allign_to(data_alloc.memory_alloc.allignment);
 
     //---insert data--//
+    auto &working_data = get_working_data();
+    const std::span<const int32_t> values = data_alloc.values;
     switch (data_alloc.memory_alloc.allignment) {
         case binary_data::allignment_t::word:
-            for (auto &val : data_alloc.values)
-                insert_data(static_cast<uint32_t>(val));
-
+            store_values<uint32_t>(working_data.grow(values.size() * sizeof(uint32_t)), values);
             break;
         case binary_data::allignment_t::halfword:
-            for (auto &val : data_alloc.values)
-                insert_data(static_cast<uint16_t>(val));
-
+            store_values<uint16_t>(working_data.grow(values.size() * sizeof(uint16_t)), values);
             break;
         case binary_data::allignment_t::byte:
-            for (auto &val : data_alloc.values)
-                insert_data(static_cast<uint8_t>(val));
-
+            store_values<uint8_t>(working_data.grow(values.size() * sizeof(uint8_t)), values);
             break;
     }
 
@@ -172,44 +471,31 @@ uint32_t elf_generator::push_data(const binary_data::data_alloc_t &data_alloc) {
 uint32_t elf_generator::allign_to(binary_data::allignment_t allignment) {
     auto &working_data = get_working_data();
     const uint32_t alligned_size = binary_data::allign(working_data.size(), allignment);
-    const uint32_t diff = alligned_size - working_data.size();
-    working_data.insert(working_data.size(), diff, 0);
+    working_data.push_zeros(alligned_size - working_data.size());
     return alligned_size;
 }
 
-void elf_generator::insert_data(uint8_t val) {
-    get_working_data().push_back(val);
-}
-
-void elf_generator::insert_data(uint16_t val) {
-    //least significant first
-    insert_data(static_cast<uint8_t>(val));
-    //most significant second
-    insert_data(static_cast<uint8_t>(val >> 8));
-}
-
-void elf_generator::insert_data(uint32_t val) {
-    //least significant first
-    insert_data(static_cast<uint16_t>(val));
-    //most significant second
-    insert_data(static_cast<uint16_t>(val >> 16));
+void elf_generator::reserve(uint32_t nbytes) {
+    get_working_data().reserve(nbytes);
 }
 
 uint32_t elf_generator::push_data(uint32_t val) {
     const auto placement_address = allign_to(binary_data::allignment_t::word);
-    insert_data(val);
+    val = to_little_endian(val);
+    std::memcpy(get_working_data().grow(sizeof(val)), &val, sizeof(val));
     return placement_address;
 }
 
 uint32_t elf_generator::push_data(uint16_t val) {
     const auto placement_address = allign_to(binary_data::allignment_t::halfword);
-    insert_data(val);
+    val = to_little_endian(val);
+    std::memcpy(get_working_data().grow(sizeof(val)), &val, sizeof(val));
     return placement_address;
 }
 
 uint32_t elf_generator::push_data(uint8_t val) {
     const auto placement_address = get_working_data().size();
-    insert_data(val);
+    *get_working_data().grow(sizeof(val)) = (char) val;
     return placement_address;
 }
 
@@ -219,22 +505,24 @@ elf_generator::push_zero_alloc(const binary_data::memory_alloc_t &mem_alloc) {
     //align
     placement_address = allign_to(mem_alloc.allignment);
     //insert zeros
-    get_working_data().insert(get_working_data().size(), mem_alloc.nbytes, 0);
+    get_working_data().push_zeros(mem_alloc.nbytes);
 
     return placement_address;
 }
 
-uint32_t elf_generator::add_string(const std::string &str) {
-    ELFIO::string_section_accessor str_writer(str_sec);
-    return str_writer.add_string(str);
+uint32_t elf_generator::add_string(const char *str) {
+    if (strtab.empty()) strtab.push_back('\0');
+
+    const uint32_t offset = strtab.size();
+    strtab.append(str, std::strlen(str) + 1);
+    return offset;
 }
 
 uint32_t elf_generator::insert_symbol_def(const symbol &sym) {
-    ELFIO::symbol_section_accessor sym_writer(writer, sym_sec);
+    assert(sym.identifier != identifier_table::none);
 
-    assert(sym.identifier.size() != 0);
-
-    const ELFIO::Elf32_Word name = add_string(sym.identifier);
+    //the identifier is only turned into a string here
+    const ELFIO::Elf32_Word name = add_string(identifiers().c_str(sym.identifier));
     const ELFIO::Elf32_Addr address_value = sym.address;
     const ELFIO::Elf32_Word size = sym.size;
     unsigned char info;
@@ -282,30 +570,37 @@ uint32_t elf_generator::insert_symbol_def(const symbol &sym) {
     }
 
 
-    return sym_writer.add_symbol(name, address_value, size, info, 0, section_index);
+    //entry 0 is the undefined symbol
+    if (symtab.empty()) symtab.push_back({});
+
+    symtab.push_back({name, address_value, size, info, 0, (ELFIO::Elf_Half) section_index});
+    return symtab.size() - 1;
 }
 
 ELFIO::Elf_Half elf_generator::get_sec_index(binary::section_t section){
     switch (section) {
         case binary::section_t::text:
-            return text_sec->get_index();
+            return text_index;
         case binary::section_t::data:
-            return data_sec->get_index();
+            return data_index;
         case binary::section_t::bss:
-            return bss_sec->get_index();
+            return bss_index;
         case binary::section_t::rodata:
-            return rodata_sec->get_index();
+            return rodata_index;
     }
 
     assert(false);
 }
 
 void elf_generator::insert_symbol_ref(const symbol_ref &sref) {
-    ELFIO::relocation_section_accessor ref_writer(writer, rel_sec);
     const ELFIO::Elf32_Addr address_value = sref.address;
     const ELFIO::Elf_Word symbol_index = sref.symbol_id;
-    ref_writer.add_entry(address_value, symbol_index, (int) sref.type);
+    reltab.push_back({address_value, ELF32_R_INFO(symbol_index, (int) sref.type)});
 }
 void elf_generator::set_entrypoint(uint32_t address) {
     entry_point = address;
 }
+
+void elf_generator::set_exec_layout(const binary::section_addresses &addresses) {
+    exec_addresses = addresses;
+}
@@ -0,0 +1,97 @@
+#include "elf_image.h"
+
+#include <cstring>
+#include <stdexcept>
+
+//returns the string at offset in a string table section, empty when out of bounds
+static std::string_view string_at(std::span<const uint8_t> strtab, uint32_t offset) {
+    if (offset >= strtab.size()) return {};
+
+    const char *str = reinterpret_cast<const char *>(strtab.data()) + offset;
+    return {str, strnlen(str, strtab.size() - offset)};
+}
+
+elf_image elf_image::map_file(const std::filesystem::path &path) {
+    elf_image image;
+    image.file_m = source_buffer::map_file(path);
+
+    const auto *bytes = reinterpret_cast<const uint8_t *>(image.file_m.data());
+    const std::size_t size = image.file_m.size();
+
+    //---header---//
+    if (size < sizeof(ELFIO::Elf32_Ehdr) || bytes[ELFIO::EI_MAG0] != ELFIO::ELFMAG0 ||
+        bytes[ELFIO::EI_MAG1] != ELFIO::ELFMAG1 || bytes[ELFIO::EI_MAG2] != ELFIO::ELFMAG2 ||
+        bytes[ELFIO::EI_MAG3] != ELFIO::ELFMAG3)
+        throw std::runtime_error("not an elf file");
+
+    image.header_m = reinterpret_cast<const ELFIO::Elf32_Ehdr *>(bytes);
+    const auto &header = *image.header_m;
+    if (header.e_ident[ELFIO::EI_CLASS] != ELFIO::ELFCLASS32 ||
+        header.e_ident[ELFIO::EI_DATA] != ELFIO::ELFDATA2LSB)
+        throw std::runtime_error("only 32 bit little endian elf files are supported");
+
+    //---section headers---//
+    if (header.e_shentsize != sizeof(ELFIO::Elf32_Shdr) || header.e_shoff % 4 != 0 ||
+        header.e_shoff > size || (size - header.e_shoff) / sizeof(ELFIO::Elf32_Shdr) < header.e_shnum)
+        throw std::runtime_error("malformed section header table");
+
+    image.sections_m = {reinterpret_cast<const ELFIO::Elf32_Shdr *>(bytes + header.e_shoff),
+                        header.e_shnum};
+
+    for (const auto &section: image.sections_m) {
+        if (section.sh_type != ELFIO::SHT_NOBITS &&
+            (section.sh_offset > size || size - section.sh_offset < section.sh_size))
+            throw std::runtime_error("section outside of the file");
+
+        if (section.sh_type == ELFIO::SHT_SYMTAB) image.symtab_m = &section;
+    }
+
+    if (header.e_shstrndx >= image.sections_m.size())
+        throw std::runtime_error("malformed section name table index");
+
+    return image;
+}
+
+std::span<const uint8_t> elf_image::section_data(const ELFIO::Elf32_Shdr &section) const {
+    if (section.sh_type == ELFIO::SHT_NOBITS) return {};
+
+    return {reinterpret_cast<const uint8_t *>(file_m.data()) + section.sh_offset, section.sh_size};
+}
+
+template<typename entry_t>
+std::span<const entry_t> elf_image::section_entries(const ELFIO::Elf32_Shdr &section) const {
+    const auto data = section_data(section);
+    if (reinterpret_cast<uintptr_t>(data.data()) % alignof(entry_t) != 0)
+        throw std::runtime_error("misaligned table section");
+
+    return {reinterpret_cast<const entry_t *>(data.data()), data.size() / sizeof(entry_t)};
+}
+
+std::string_view elf_image::section_name(const ELFIO::Elf32_Shdr &section) const {
+    return string_at(section_data(sections_m[header_m->e_shstrndx]), section.sh_name);
+}
+
+const ELFIO::Elf32_Shdr *elf_image::find_section(std::string_view name) const {
+    for (const auto &section: sections_m)
+        if (section_name(section) == name) return &section;
+
+    return nullptr;
+}
+
+std::span<const ELFIO::Elf32_Sym> elf_image::symbols() const {
+    if (symtab_m == nullptr) return {};
+    return section_entries<ELFIO::Elf32_Sym>(*symtab_m);
+}
+
+std::string_view elf_image::symbol_name(const ELFIO::Elf32_Sym &sym) const {
+    if (symtab_m == nullptr || symtab_m->sh_link >= sections_m.size()) return {};
+    return string_at(section_data(sections_m[symtab_m->sh_link]), sym.st_name);
+}
+
+std::span<const ELFIO::Elf32_Rel> elf_image::relocations(const ELFIO::Elf32_Shdr &target) const {
+    for (const auto &section: sections_m)
+        if (section.sh_type == ELFIO::SHT_REL && section.sh_info == section_index(target))
+            return section_entries<ELFIO::Elf32_Rel>(section);
+
+    return {};
+}
@@ -0,0 +1,52 @@
+#include "identifier_table.h"
+
+#include <algorithm>
+#include <cstring>
+
+identifier_table::identifier_table() {
+    strings_m.push_back("");
+}
+
+std::string_view identifier_table::store(std::string_view str) {
+    const std::size_t nbytes = str.size() + 1;
+
+    //names longer than a block get a block of their own
+    const std::size_t nalloc = std::max(nbytes, block_size);
+    if (block_size - block_used_m < nbytes) {
+        blocks_m.push_back(std::make_unique<char[]>(nalloc));
+        block_used_m = 0;
+    }
+
+    char *dest = blocks_m.back().get() + block_used_m;
+    block_used_m = std::min(block_used_m + nbytes, block_size);
+
+    std::memcpy(dest, str.data(), str.size());
+    dest[str.size()] = '\0';
+    return {dest, str.size()};
+}
+
+identifier_table::handle identifier_table::intern(std::string_view str) {
+    if (str.empty()) return none;
+
+    const auto it = handles_m.find(str);
+    if (it != handles_m.end()) return it->second;
+
+    const auto id = static_cast<handle>(strings_m.size());
+    const auto stored = store(str);
+    strings_m.push_back(stored);
+    handles_m.emplace(stored, id);
+    return id;
+}
+
+bool identifier_table::find(std::string_view str, handle &result) const {
+    const auto it = handles_m.find(str);
+    if (it == handles_m.end()) return false;
+
+    result = it->second;
+    return true;
+}
+
+identifier_table &identifiers() {
+    static identifier_table table;
+    return table;
+}
@@ -4,6 +4,7 @@
 
 #include "isa.h"
 #include "bitwise_functions.h"
+#include "binary_data.h"
 
 uint32_t set_bit_extension(uint32_t val, uint8_t pos, isa::extension_type ext_type) {
     uint32_t result;
@@ -28,74 +29,117 @@ uint32_t set_bit_extension(uint32_t val, uint8_t pos, isa::extension_type ext_ty
     return result;
 }
 
+//the operand dependent part of encode, branch free: operands a format lacks have an empty mask
+static uint32_t encode_word(const isa::instruction &inst) {
+    assert(inst.id != isa::inst_id::INVALID);
+    const isa::encoding_template &tmpl = isa::encoding_template_lut[inst.id];
+    const isa::format_encoding &fields = tmpl.fields;
+
+    const int32_t imm = tmpl.halve_immediate ? inst.immediate / 2 : inst.immediate;
+
+    uint32_t word = tmpl.fixed_bits;
+    word |= ((uint32_t) inst.dr & fields.dr.mask) << fields.dr.pos;
+    word |= ((uint32_t) inst.sr1 & fields.sr1.mask) << fields.sr1.pos;
+    word |= ((uint32_t) inst.sr2 & fields.sr2.mask) << fields.sr2.pos;
+    word |= ((uint32_t) imm & fields.imm_lower.mask) << fields.imm_lower.pos;
+    word |= ((uint32_t) (imm >> fields.imm_upper_shift) & fields.imm_upper.mask) << fields.imm_upper.pos;
+    return word;
+}
+
 isa::encoded_instruction isa::instruction::encode() const {
-    assert(id != inst_id::INVALID);
+    const uint32_t word = encode_word(*this);
 
     encoded_instruction encoded;
-    auto inst_info = get_inst_type(id);
-
     encoded.fullword = 0;
-
-    if (inst_info.is_halfword) {
-        /*---half word---*/
+    if (encoding_template_lut[id].is_halfword) {
         encoded.size = instruction_size_type::halfword;
-
-        /*---bitmode---*/
-        bitwise_place(encoded.halfword, 0, bitmode_pos, bitmode_bitsize);
-
-        /*--set opcode---*/
-        bitwise_place(encoded.halfword, inst_info.opcode, opcode_pos, opcode_bitsize);
-
-        if (inst_info.format == format_id::half_immediate) {
-            /*---set immediate---*/
-            auto imm = bitwize_select(immediate, 0, halfword_immediate_bitsize);
-            bitwise_place(encoded.halfword, imm, halfword_immediate_pos, halfword_immediate_bitsize);
-        } else {
-            /*---set sr---*/
-            assert(inst_info.format == format_id::half_reg);
-            bitwise_place(encoded.halfword, (uint16_t) sr2, halfword_sr_pos, reg_bitsize);
-        }
-
-        /*---set dr---*/
-        bitwise_place(encoded.halfword, (uint16_t) dr, halfword_dr_pos, reg_bitsize);
-
+        encoded.halfword = word;
     } else {
-        /*---full word---*/
         encoded.size = instruction_size_type::fullword;
+        encoded.fullword = word;
+    }
 
-        /*---set bitmode---*/
-        bitwise_place(encoded.fullword, 1, bitmode_pos, bitmode_bitsize);
+    return encoded;
+}
 
-        /*--set opcode---*/
-        bitwise_place(encoded.fullword, inst_info.opcode, opcode_pos, opcode_bitsize);
+uint32_t isa::encode_many(std::span<const instruction> insts, uint8_t *text, uint32_t offset) {
+    for (const auto &inst: insts) {
+        const uint32_t word = encode_word(inst);
 
-        /*---set fun---*/
-        if (inst_info.format == format_id::reg)
-            bitwise_place(encoded.fullword, inst_info.funcode, fun_pos, longfun_bitsize);
-        else
-            bitwise_place(encoded.fullword, inst_info.funcode, fun_pos, shortfun_bitsize);
+        if (encoding_template_lut[inst.id].is_halfword) {
+            offset = binary_data::allign(offset, binary_data::allignment_t::halfword);
+            text[offset] = word;
+            text[offset + 1] = word >> 8;
+            offset += 2;
+        } else {
+            offset = binary_data::allign(offset, binary_data::allignment_t::word);
+            text[offset] = word;
+            text[offset + 1] = word >> 8;
+            text[offset + 2] = word >> 16;
+            text[offset + 3] = word >> 24;
+            offset += 4;
+        }
+    }
 
-        auto operand_form = format_operand_form_lut[format];
+    return offset;
+}
 
-        /*---set sr2---*/
-        if (operand_form.sr2)
-            bitwise_place(encoded.fullword, (uint16_t) sr2, sr2_pos, reg_bitsize);
+static isa::instruction decode_with_template(uint32_t encoded, isa::inst_id id) {
+    const isa::decoding_template &tmpl = isa::decoding_template_lut[id];
 
-        /*---set sr1---*/
-        if (operand_form.sr1)
-            bitwise_place(encoded.fullword, (uint16_t) sr1, sr1_pos, reg_bitsize);
+    isa::instruction inst;
+    inst.id = id;
+    inst.format = tmpl.format;
+    inst.dr = (isa::reg_id) (((encoded >> tmpl.dr.pos) & tmpl.dr.mask) | (uint32_t) tmpl.dr_fixed);
+    inst.sr1 = (isa::reg_id) ((encoded >> tmpl.sr1.pos) & tmpl.sr1.mask);
+    inst.sr2 = (isa::reg_id) ((encoded >> tmpl.sr2.pos) & tmpl.sr2.mask);
 
-        /*---set dr---*/
-        if (operand_form.dr)
-            bitwise_place(encoded.fullword, (uint16_t) dr, dr_pos, reg_bitsize);
+    uint32_t imm = (encoded >> tmpl.imm_lower.pos) & tmpl.imm_lower.mask;
+    imm |= ((encoded >> tmpl.imm_upper.pos) & tmpl.imm_upper.mask) << tmpl.imm_upper_shift;
+    imm |= tmpl.imm_one_bits | (tmpl.imm_sign_bits & (0u - ((imm >> tmpl.imm_sign_pos) & 1)));
+    inst.immediate = (int32_t) (imm << tmpl.imm_shift);
 
-        /*--set immediate---*/
-        if(operand_form.imm)
-            encode_fullword_immediate(encoded.fullword);
+    return inst;
+}
 
+void isa::decode_many(std::span<const uint8_t> text, std::vector<located_instruction> &out) {
+    //one pass in address order, the bitmode bit of the first halfword gives the size. Same result
+    //as instruction(encoded_instruction) but table driven, operands come from decoding_template_lut
+    out.reserve(out.size() + text.size() / 2);
+
+    constexpr uint32_t opcode_mask = (1u << opcode_bitsize) - 1;
+    constexpr auto halfword = instruction_size_type::halfword;
+    constexpr auto fullword = instruction_size_type::fullword;
+
+    for (uint32_t address = 0; address + 2 <= text.size();) {
+        const uint8_t *bytes = text.data() + address;
+
+        if ((bytes[0] & 1) == 0) {
+            const uint32_t encoded = bytes[0] | bytes[1] << 8;
+            const uint32_t opcode = (encoded >> opcode_pos) & opcode_mask;
+            const inst_id id = inst_id_decode_lut[decode_index(opcode, 0, halfword)];
+
+            instruction inst{};
+            if (id != inst_id::INVALID) inst = decode_with_template(encoded, id);
+            out.push_back({.address = address, .size = halfword, .inst = inst});
+            address += 2;
+        } else if (address % 4 == 0 && address + 4 <= text.size()) {
+            const uint32_t encoded = bytes[0] | bytes[1] << 8 | bytes[2] << 16 |
+                                     (uint32_t) bytes[3] << 24;
+            const uint32_t opcode = (encoded >> opcode_pos) & opcode_mask;
+            const uint32_t funcode = (encoded >> fun_pos) & funcode_mask_lut[opcode];
+            const inst_id id = inst_id_decode_lut[decode_index(opcode, funcode, fullword)];
+
+            instruction inst{};
+            if (id != inst_id::INVALID) inst = decode_with_template(encoded, id);
+            out.push_back({.address = address, .size = fullword, .inst = inst});
+            address += 4;
+        } else {
+            //a fullword bitmode out of place, it stays INVALID
+            out.push_back({.address = address, .size = halfword, .inst = {}});
+            address += 2;
+        }
     }
-
-    return encoded;
 }
 
 void isa::instruction::decode_fullword_instruction(uint32_t encoded_inst) {
@@ -292,37 +336,3 @@ std::string isa::instruction::to_str() const {
 
     return str;
 }
-
-void isa::instruction::encode_fullword_immediate(uint32_t &inst) const {
-    switch (format) {
-        case format_id::branch: {
-            const auto shifted_immediate = isa::is_store_inst(id) ? immediate : (immediate / 2);
-            const auto lowerimm = bitwize_select(shifted_immediate, 0, branch_lowerimmediate_bitsize);
-            bitwise_place(inst, lowerimm, branch_lowerimmediate_pos, branch_lowerimmediate_bitsize);
-            const auto upperimm = bitwize_select(shifted_immediate, branch_lowerimmediate_bitsize, branch_upperimmediate_bitsize);
-            bitwise_place(inst, upperimm, branch_upperimmediate_pos, branch_upperimmediate_bitsize);
-            break;
-        }
-
-        case format_id::immediate: {
-            const auto imm = bitwize_select(immediate, 0, imm_immediate_bitsize);
-            bitwise_place(inst, imm, imm_immediate_pos, imm_immediate_bitsize);
-            break;
-        }
-
-        case format_id::set: {
-            const auto imm = bitwize_select(immediate, 0, set_immediate_bitsize);
-            bitwise_place(inst, imm, set_immediate_pos, set_immediate_bitsize);
-            break;
-        }
-
-        case format_id::jump: {
-            const auto shifted_immediate = immediate / 2;
-            const auto imm = bitwize_select(shifted_immediate, 0, jump_immediate_bitsize);
-            bitwise_place(inst, imm, jump_immediate_pos, jump_immediate_bitsize);
-            break;
-        }
-        default:
-            break;
-    }
-}
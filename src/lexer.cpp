@@ -3,28 +3,96 @@
 //
 
 #include "lexer.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
 
-lexer::token lexer::fetch_token() {
-    if (yyin.eof()) {
-        read_token_m.id = token::types::eof;
+template<class source_t>
+void lexer::open_scanner(source_t &source, lexer_backend backend) {
+    switch (backend) {
+        case lexer_backend::simd:
+            simd_m.emplace(source);
+            break;
+        case lexer_backend::flex:
+#ifdef ASSEMBLER_FLEX_LEXER
+            flex_m.emplace(source);
+            break;
+#else
+            throw std::runtime_error("assembler was built without the flex lexer");
+#endif
+    }
+}
+
+lexer::lexer(std::string_view source, lexer_backend backend) {
+    open_scanner(source, backend);
+}
+
+lexer::lexer(ring_buffer &source, lexer_backend backend) {
+    open_scanner(source, backend);
+}
+
+template<class scanner_t>
+void lexer::read_token(scanner_t &scanner, token::types token_type) {
+    read_token_m.id = token_type;
+    read_token_m.text_m = scanner.text();
+    read_token_m.line = scanner.line();
+
+    switch (token_type) {
+        case token::types::mnemonic:
+            read_token_m.mnemonic_m = scanner.mnemonic();
+            break;
+        case token::types::reg:
+            read_token_m.reg_m = scanner.reg();
+            break;
+        case token::types::directive:
+            read_token_m.directive_m = scanner.directive();
+            break;
+        case token::types::label:
+            read_token_m.label_m = identifiers().intern(read_token_m.text_m);
+            break;
+        default:
+            break;
+    }
+}
+
+const lexer::token &lexer::fetch_token() {
+    if (read_token_m.id == token::types::eof) {
         read_token_m.text_m = "";
-	read_token_m.line = yylineno;
 
         return read_token_m;
     }
 
-    auto token_type = (token::types) yylex();
+    if (simd_m) {
+        //never returns none tokens
+        read_token(*simd_m, (token::types) simd_m->scan());
+        return read_token_m;
+    }
 
-    if (token_type == token::types::none)
-        return fetch_token();
+#ifdef ASSEMBLER_FLEX_LEXER
+    auto token_type = (token::types) flex_m->scan();
+    while (token_type == token::types::none)
+        token_type = (token::types) flex_m->scan();
 
-    read_token_m.id = token_type;
-    read_token_m.text_m = yytext;
-    read_token_m.line = yylineno;
+    read_token(*flex_m, token_type);
+#endif
 
     return read_token_m;
 }
 
+#ifdef ASSEMBLER_FLEX_LEXER
+int flex_scanner::LexerInput(char *buf, int max_size) {
+    if (source_ring_m != nullptr)
+        return static_cast<int>(source_ring_m->read(buf, max_size));
+
+    //copies the next chunk straight out of the source buffer, no stream in between
+    const auto nbytes = std::min(source_m.size(), static_cast<std::size_t>(max_size));
+    std::memcpy(buf, source_m.data(), nbytes);
+    source_m.remove_prefix(nbytes);
+
+    return static_cast<int>(nbytes);
+}
+#endif
+
 const std::string &lexer::token::type_to_string(types typ) {
     static const std::string lut[] = {
             "EOF",
@@ -47,6 +115,10 @@ const std::string &lexer::token::type_to_string(types typ) {
     return lut[(int) typ];
 }
 
+int lexer::token::get_line() const {
+    return line;
+}
+
 bool lexer::token::is_integer() const {
     return (id == types::binary_integer ||
             id == types::hex_integer ||
@@ -0,0 +1,95 @@
+#include "preprocessor.h"
+
+#include <functional>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+extern "C" int gpp(int argc, char **argv, FILE *output_file, FILE *input_file);
+
+static bool is_pp_char(char c) { return c == '#' || c == '\\'; }
+
+bool needs_preprocessing(std::string_view source) {
+    const char *it = source.data();
+    const char *const end = it + source.size();
+
+#if defined(__AVX2__)
+    const __m256i hash = _mm256_set1_epi8('#');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    for (; end - it >= 32; it += 32) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(it));
+        const __m256i found = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, hash),
+                                              _mm256_cmpeq_epi8(chunk, backslash));
+        if (_mm256_movemask_epi8(found) != 0) return true;
+    }
+#elif defined(__SSE2__)
+    const __m128i hash = _mm_set1_epi8('#');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    for (; end - it >= 16; it += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(it));
+        const __m128i found =
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, hash), _mm_cmpeq_epi8(chunk, backslash));
+        if (_mm_movemask_epi8(found) != 0) return true;
+    }
+#endif
+
+    //---tail (or everything without simd)---//
+    for (; it != end; ++it)
+        if (is_pp_char(*it)) return true;
+
+    return false;
+}
+
+preprocessor_pipeline::preprocessor_pipeline(char **argv, const source_buffer &source, FILE *tee)
+    : ring_m(ring_capacity), tee_m(tee) {
+    producer_m = std::thread(&preprocessor_pipeline::produce, this, argv, std::cref(source));
+}
+
+preprocessor_pipeline::~preprocessor_pipeline() {
+    ring_m.close_read();
+    producer_m.join();
+}
+
+void preprocessor_pipeline::produce(char **argv, const source_buffer &source) {
+    //gpp reads straight out of the source buffer
+    FILE *macro_input = fmemopen(const_cast<char *>(source.data()), source.size(), "r");
+
+    //gpp's output goes through the ring buffer to the lexer
+    const cookie_io_functions_t output_functions = {
+            .read = nullptr,
+            .write = &preprocessor_pipeline::write_output,
+            .seek = nullptr,
+            .close = &preprocessor_pipeline::close_output,
+    };
+    FILE *output_assembly = fopencookie(this, "w", output_functions);
+
+    if (macro_input != nullptr && output_assembly != nullptr)
+        gpp(1, argv, output_assembly, macro_input);
+
+    if (macro_input != nullptr) fclose(macro_input);
+
+    //gpp may or may not close its output itself, close_output marks it closed
+    if (output_assembly != nullptr && output_closed_m == false) fclose(output_assembly);
+
+    //an unreadable input ends up as an empty token stream
+    ring_m.close_write();
+}
+
+ssize_t preprocessor_pipeline::write_output(void *cookie, const char *buf, size_t size) {
+    auto &pipeline = *static_cast<preprocessor_pipeline *>(cookie);
+
+    if (pipeline.tee_m != nullptr) fwrite(buf, 1, size, pipeline.tee_m);
+
+    //the lexer stopped reading, report a write error to gpp
+    if (pipeline.ring_m.write(buf, size) == false) return 0;
+
+    return size;
+}
+
+int preprocessor_pipeline::close_output(void *cookie) {
+    auto &pipeline = *static_cast<preprocessor_pipeline *>(cookie);
+    pipeline.output_closed_m = true;
+    pipeline.ring_m.close_write();
+    return 0;
+}
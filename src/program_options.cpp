@@ -9,6 +9,16 @@ program_options::program_options(int argc, char **args) {
     //---set default options---//
     short_jumps = false;
     save_pp_result = false;
+    preprocess = true;
+    time_report = false;
+    jobs = 1;
+    zero_data_to_bss = false;
+    exec_layout = false;
+#ifdef ASSEMBLER_FLEX_LEXER
+    lexer = lexer_backend::flex;
+#else
+    lexer = lexer_backend::simd;
+#endif
 
     //---parse options---//
     bool input_set = false;
@@ -27,9 +37,49 @@ program_options::program_options(int argc, char **args) {
                 case option_id::save_pp_result:
                     save_pp_result = true;
                     break;
+                case option_id::no_preprocess:
+                    preprocess = false;
+                    break;
                 case option_id::short_jump:
                     short_jumps = true;
                     break;
+                case option_id::time_report:
+                    time_report = true;
+                    break;
+                case option_id::zero_data_to_bss:
+                    zero_data_to_bss = true;
+                    break;
+                case option_id::exec_layout:
+                    exec_layout = true;
+                    break;
+                case option_id::lexer:
+                    argc--;
+                    args++;
+                    if(argc == 0 || is_option_specifier(*args))
+                        throw std::runtime_error("missing backend after --lexer");
+
+                    if(std::string(*args) == "simd") {
+                        lexer = lexer_backend::simd;
+                    } else if(std::string(*args) == "flex") {
+#ifdef ASSEMBLER_FLEX_LEXER
+                        lexer = lexer_backend::flex;
+#else
+                        throw std::runtime_error("assembler was built without the flex lexer");
+#endif
+                    } else {
+                        throw std::runtime_error("unknown lexer backend, expected flex or simd");
+                    }
+                    break;
+                case option_id::jobs:
+                    argc--;
+                    args++;
+                    if(argc == 0 || is_option_specifier(*args))
+                        throw std::runtime_error("missing job count after -j");
+
+                    jobs = std::stoul(*args);
+                    if(jobs == 0)
+                        throw std::runtime_error("job count must be at least 1");
+                    break;
                 case option_id::output:
                     argc--;
                     args++;
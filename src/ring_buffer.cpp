@@ -0,0 +1,64 @@
+#include "ring_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+bool ring_buffer::write(const char *buf, std::size_t nbytes) {
+    const std::size_t capacity = data_m.size();
+
+    while (nbytes != 0) {
+        std::unique_lock lock(mutex_m);
+        writable_m.wait(lock, [&] { return count_m != capacity || read_closed_m; });
+        if (read_closed_m) return false;
+
+        //---copy into the free space, at most up to the end of the storage---//
+        const std::size_t tail = (head_m + count_m) % capacity;
+        const std::size_t nfree = capacity - count_m;
+        const std::size_t nchunk = std::min({nbytes, nfree, capacity - tail});
+        std::memcpy(data_m.data() + tail, buf, nchunk);
+        count_m += nchunk;
+
+        lock.unlock();
+        readable_m.notify_one();
+
+        buf += nchunk;
+        nbytes -= nchunk;
+    }
+
+    return true;
+}
+
+std::size_t ring_buffer::read(char *buf, std::size_t max_size) {
+    const std::size_t capacity = data_m.size();
+
+    std::unique_lock lock(mutex_m);
+    readable_m.wait(lock, [&] { return count_m != 0 || write_closed_m; });
+    if (count_m == 0) return 0;
+
+    //---copy out the unread bytes, at most up to the end of the storage---//
+    const std::size_t nchunk = std::min({max_size, count_m, capacity - head_m});
+    std::memcpy(buf, data_m.data() + head_m, nchunk);
+    head_m = (head_m + nchunk) % capacity;
+    count_m -= nchunk;
+
+    lock.unlock();
+    writable_m.notify_one();
+
+    return nchunk;
+}
+
+void ring_buffer::close_write() {
+    {
+        std::lock_guard lock(mutex_m);
+        write_closed_m = true;
+    }
+    readable_m.notify_all();
+}
+
+void ring_buffer::close_read() {
+    {
+        std::lock_guard lock(mutex_m);
+        read_closed_m = true;
+    }
+    writable_m.notify_all();
+}
@@ -1,13 +1,33 @@
 //
 // Created by djordy on 1/2/23.
 //
+#include <algorithm>
+#include <numeric>
 #include <unordered_set>
 
 #include "semantic_statement.h"
 #include "binary.h"
+#include "identifier_table.h"
+#include "parallel.h"
 #include "program_options.h"
 #include "semantic_analyzer.h"
 #include "syntax.h"
+#include "time_report.h"
+
+//---text partitions---//
+//a run of text statements that starts at the first word aligned statement from a global label on.
+//Every alignment is at most a word, so a partition lays out the same at any word aligned address
+//and can be sized on its own.
+struct text_partition {
+    uint32_t first_stmnt = 0;
+    uint32_t last_stmnt = 0;
+    uint32_t first_label = 0;//range in label_defs
+    uint32_t last_label = 0;
+    uint32_t first_group = 0;//range in the relax groups, of the labels defined in this partition
+    uint32_t last_group = 0;
+};
+
+using label_def = std::pair<uint32_t, int32_t>;//statement index, symbol id
 
 static void insert_data_statement(semantic_statements::directive_statement &stmnt,
                                   binary::section_t working_section,
@@ -16,36 +36,43 @@ static void insert_data_statement(semantic_statements::directive_statement &stmn
                                   std::vector<semantic_statements::data_directive> &bss);
 
 static void
-link_backward_labels(std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_statements);
+link_backward_labels(std::vector<semantic_statements::inst_statement> &text_statements);
 static void
-link_forward_labels(std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_statements);
-static const std::vector<int>
-get_compile_cases(symbol_table &st,
-                  std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_stmnts,
-                  std::unordered_set<std::string> &globals, const program_options &options);
+link_forward_labels(std::vector<semantic_statements::inst_statement> &text_statements);
+static std::vector<text_layout_entry>
+get_text_layout(symbol_table &st, std::vector<semantic_statements::inst_statement> &text_stmnts,
+                std::unordered_set<identifier_table::handle> &globals,
+                std::vector<text_partition> &partitions, const program_options &options);
 
-std::vector<isa::instruction>
-generate_instructions(std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_stmnts,
-                      const std::vector<int> &compile_cases, symbol_table &st);
+std::vector<uint8_t>
+generate_text(const std::vector<semantic_statements::inst_statement> &text_stmnts,
+              const std::vector<text_layout_entry> &layout, symbol_table &st, unsigned njobs);
 
 static void calculate_text_label_addresses(
-        std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_stmnts,
-        const std::vector<int> &compile_cases, symbol_table &st);
+        std::vector<semantic_statements::inst_statement> &text_stmnts,
+        const std::vector<text_layout_entry> &layout, const std::vector<text_partition> &partitions,
+        symbol_table &st, unsigned njobs);
 
 std::vector<binary_data::data_alloc_t>
 process_data_directives(binary::section_t section,
                         const std::vector<semantic_statements::data_directive> &data_stmnts, symbol_table &st,
-                        std::unordered_set<std::string> &globals);
+                        std::unordered_set<identifier_table::handle> &globals);
+
+static uint32_t promote_zero_data(std::vector<semantic_statements::data_directive> &data,
+                                  std::vector<semantic_statements::data_directive> &bss);
+
+static binary::section_addresses exec_section_addresses(const compilation_unit &comp_unit);
+static void rebase_symbols(symbol_table &st, const binary::section_addresses &addresses);
 
 struct assembly_statements {
-    std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> text;
+    std::vector<semantic_statements::inst_statement> text;
     std::vector<semantic_statements::data_directive> rodata;
     std::vector<semantic_statements::data_directive> data;
     std::vector<semantic_statements::data_directive> bss;
 };
 
 assembly_statements generate_asm_statements(syntax &parser,
-                                            std::unordered_set<std::string> &globals);
+                                            std::unordered_set<identifier_table::handle> &globals);
 
 
 compilation_unit semantic_analyzer(syntax &parser, program_options &options) {
@@ -53,9 +80,15 @@ compilation_unit semantic_analyzer(syntax &parser, program_options &options) {
 
     //---parsing assembly statements---//
     std::vector<semantic_statements::symbol_directive> symbol_dirs;
-    std::unordered_set<std::string> globals;
+    std::unordered_set<identifier_table::handle> globals;
     auto statements = generate_asm_statements(parser, globals);
 
+    //---move zero data to bss---//
+    if (options.zero_data_to_bss) {
+        const auto nbytes_saved = promote_zero_data(statements.data, statements.bss);
+        time_report::set_counter(".data bytes moved to .bss", nbytes_saved);
+    }
+
     //---process data sections---//
     comp_unit.data = process_data_directives(binary::section_t::data, statements.data, comp_unit.st,
                                              globals);
@@ -69,20 +102,32 @@ compilation_unit semantic_analyzer(syntax &parser, program_options &options) {
     link_backward_labels(statements.text);
     link_forward_labels(statements.text);
 
-    //---get text compile cases and insert symbols---//
-    const auto compile_cases = get_compile_cases(comp_unit.st, statements.text, globals, options);
+    //---get text layout and insert symbols---//
+    //every later pass reads the compile case, size and address of a statement from the layout table
+    std::vector<text_partition> partitions;
+    comp_unit.text_layout =
+            get_text_layout(comp_unit.st, statements.text, globals, partitions, options);
 
     //---text label calculation---//
-    calculate_text_label_addresses(statements.text, compile_cases, comp_unit.st);
+    calculate_text_label_addresses(statements.text, comp_unit.text_layout, partitions, comp_unit.st,
+                                   options.jobs);
+
+    //---assign virtual addresses---//
+    //data symbols have to be final before text is generated, their addresses are encoded in it
+    if (options.exec_layout) {
+        comp_unit.exec_addresses = exec_section_addresses(comp_unit);
+        rebase_symbols(comp_unit.st, *comp_unit.exec_addresses);
+    }
 
-    //---generate instructions and relocs---//
-    comp_unit.instructions = generate_instructions(statements.text, compile_cases, comp_unit.st);
+    //---generate machine code and relocs---//
+    comp_unit.text =
+            generate_text(statements.text, comp_unit.text_layout, comp_unit.st, options.jobs);
 
     return comp_unit;
 }
 
 assembly_statements generate_asm_statements(syntax &parser,
-                                            std::unordered_set<std::string> &globals) {
+                                            std::unordered_set<identifier_table::handle> &globals) {
 
 
     using stmnt_types = semantic_statements::asm_statement::types;
@@ -151,21 +196,28 @@ static void insert_data_statement(semantic_statements::directive_statement &stmn
 }
 
 static bool is_backward(const semantic_statements::label_t &lbl) {
-    return (lbl.identifier.starts_with(asm_lang::backward_label_prefix));
+    return (identifiers().view(lbl.identifier).starts_with(asm_lang::backward_label_prefix));
 }
 
 static bool is_forward(const semantic_statements::label_t &lbl) {
-    return (lbl.identifier.starts_with(asm_lang::forward_label_prefix));
+    return (identifiers().view(lbl.identifier).starts_with(asm_lang::forward_label_prefix));
+}
+
+//interns "name#tag", the name of the tag'th definition of a backward/forward label
+static identifier_table::handle tag_label(identifier_table::handle identifier, uint tag) {
+    std::string tagged{identifiers().view(identifier)};
+    tagged += "#" + std::to_string(tag);
+    return identifiers().intern(tagged);
 }
 
 static void
-link_backward_labels(std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_statements) {
+link_backward_labels(std::vector<semantic_statements::inst_statement> &text_statements) {
 
-    std::unordered_map<std::string, uint> backward_stmnt_labels;
+    std::unordered_map<identifier_table::handle, uint> backward_stmnt_labels;
     for (auto &stmnt: text_statements) {
         //---insert backward---//
-        if (stmnt->has_label()) {
-            auto &lbl = stmnt->get_label();
+        if (stmnt.has_label()) {
+            auto &lbl = stmnt.get_label();
             if (is_backward(lbl)) {
                 const auto search_it = backward_stmnt_labels.find(lbl.identifier);
                 int tag = 0;
@@ -175,35 +227,36 @@ link_backward_labels(std::vector<std::unique_ptr<semantic_statements::inst_state
                 else
                     tag = (++search_it->second);
 
-                lbl.identifier += "#" + std::to_string(tag);
+                lbl.identifier = tag_label(lbl.identifier, tag);
             }
         }
 
         //---link backward--//
-        if (stmnt->has_label_operand()) {
-            auto &lbl = stmnt->get_label_operand().label;
+        if (stmnt.has_label_operand()) {
+            auto &lbl = stmnt.get_label_operand().label;
             if (is_backward(lbl)) {
                 const auto search_it = backward_stmnt_labels.find(lbl.identifier);
                 if (search_it == backward_stmnt_labels.end())
-                    throw std::runtime_error("backward label not found: " + lbl.identifier);
+                    throw std::runtime_error("backward label not found: " +
+                                             std::string{identifiers().view(lbl.identifier)});
 
                 //---set label tag---//
                 const auto tag = search_it->second;
-                lbl.identifier += "#" + std::to_string(tag);
+                lbl.identifier = tag_label(lbl.identifier, tag);
             }
         }
     }
 }
 
 static void
-link_forward_labels(std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_statements) {
-    std::unordered_map<std::string, uint> forward_stmnt_labels;
+link_forward_labels(std::vector<semantic_statements::inst_statement> &text_statements) {
+    std::unordered_map<identifier_table::handle, uint> forward_stmnt_labels;
     for (int i = text_statements.size() - 1; i >= 0; --i) {//iterate backwards over statements
         auto &stmnt = text_statements[i];
 
         //---insert forward---//
-        if (stmnt->has_label()) {
-            auto &lbl = stmnt->get_label();
+        if (stmnt.has_label()) {
+            auto &lbl = stmnt.get_label();
             if (is_forward(lbl)) {
                 auto search_it = forward_stmnt_labels.find(lbl.identifier);
 
@@ -213,52 +266,311 @@ link_forward_labels(std::vector<std::unique_ptr<semantic_statements::inst_statem
                 else
                     tag = (++search_it->second);
 
-                lbl.identifier += ("#" + std::to_string(tag));
+                lbl.identifier = tag_label(lbl.identifier, tag);
             }
         }
 
         //---link forward--//
-        if (stmnt->has_label_operand()) {
-            auto &lbl = stmnt->get_label_operand().label;
+        if (stmnt.has_label_operand()) {
+            auto &lbl = stmnt.get_label_operand().label;
             if (is_forward(lbl)) {
                 const auto search_it = forward_stmnt_labels.find(lbl.identifier);
                 if (search_it == forward_stmnt_labels.end())
-                    throw std::runtime_error("forward label not found: " + lbl.identifier);
+                    throw std::runtime_error("forward label not found: " +
+                                             std::string{identifiers().view(lbl.identifier)});
 
                 //---set label tag---//
                 const auto tag = search_it->second;
-                lbl.identifier += ("#" + std::to_string(tag));
+                lbl.identifier = tag_label(lbl.identifier, tag);
             }
         }
     }
 }
 
-static const std::vector<int>
-get_compile_cases(symbol_table &st,
-                  std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_stmnts,
-                  std::unordered_set<std::string> &globals, const program_options &options) {
+//moves the labels of a partition to the address of their statement
+static void place_labels(const text_partition &partition, const std::vector<label_def> &label_defs,
+                         const std::vector<uint32_t> &addresses, symbol_table &st) {
+    for (uint32_t i = partition.first_label; i != partition.last_label; i++)
+        st[label_defs[i].second].address = addresses[label_defs[i].first];
+}
+
+//---relaxation---//
+//statements that jump or branch to a text label, grouped per label symbol
+struct relax_group {
+    int32_t symbol_id;
+    uint32_t label_stmnt;//index of the statement that defines the label
+    uint32_t refs_begin;
+    uint32_t refs_end;
+};
+
+struct relax_stats {
+    int64_t niterations = 0;
+    int64_t nchecks = 0;
+};
+
+//true when a statement with an index in [lo, hi) grew, grown is sorted
+static bool grew_between(const std::vector<uint32_t> &grown, uint32_t lo, uint32_t hi) {
+    const auto it = std::lower_bound(grown.begin(), grown.end(), lo);
+    return it != grown.end() && *it < hi;
+}
+
+//every iteration calls layout and grows the statements in the groups whose label is out of reach,
+//until none has to grow anymore. Statements only ever grow, so the sizes converge. Growth is always
+//a whole number of words, which shifts everything after the grown statement without changing any padding:
+//a statement only has to be checked again when a statement between it and its label grew in the
+//previous iteration. In the first iteration only the statements check_first selects are checked.
+//Grown statements and groups without statements left are dropped.
+template<typename layout_fn_t, typename check_first_fn_t>
+static relax_stats
+relax_compile_cases(const symbol_table &st,
+                    const std::vector<semantic_statements::inst_statement> &text_stmnts,
+                    std::vector<relax_group> &groups, std::vector<uint32_t> &ref_stmnts,
+                    const std::vector<uint32_t> &addresses,
+                    std::vector<binary_data::memory_alloc_t> &sizes, std::vector<int> &comp_cases,
+                    const program_options &options, layout_fn_t &&layout,
+                    check_first_fn_t &&check_first) {
+    relax_stats stats;
+    std::vector<uint32_t> grown, next_grown;
+    bool first_iteration = true;
+
+    do {
+        layout();
+        stats.niterations++;
+
+        next_grown.clear();
+        for (auto &group: groups) {
+            uint32_t keep = group.refs_begin;
+            for (uint32_t i = group.refs_begin; i != group.refs_end; i++) {
+                const uint32_t stmnt = ref_stmnts[i];
+                const uint32_t lo = std::min(stmnt, group.label_stmnt);
+                const uint32_t hi = std::max(stmnt, group.label_stmnt);
+
+                //---the distance to the label did not change---//
+                const bool check = first_iteration ? check_first(stmnt) : grew_between(grown, lo, hi);
+                if (check == false) {
+                    ref_stmnts[keep++] = stmnt;
+                    continue;
+                }
+
+                stats.nchecks++;
+                const auto compile_case =
+                        text_stmnts[stmnt].get_compile_case(st, addresses[stmnt], options);
+                const auto size = text_stmnts[stmnt].get_size(compile_case);
+
+                //---grown statements are final, they are not checked again---//
+                if (size.nbytes > sizes[stmnt].nbytes) {
+                    assert((size.nbytes - sizes[stmnt].nbytes) % 4 == 0);
+                    next_grown.push_back(stmnt);
+                } else {
+                    assert(size.nbytes == sizes[stmnt].nbytes);
+                    ref_stmnts[keep++] = stmnt;
+                }
+
+                comp_cases[stmnt] = compile_case;
+                sizes[stmnt] = size;
+            }
+
+            group.refs_end = keep;
+        }
+
+        std::erase_if(groups, [](const relax_group &group) { return group.refs_begin == group.refs_end; });
+        std::sort(next_grown.begin(), next_grown.end());
+        std::swap(grown, next_grown);
+        first_iteration = false;
+    } while (grown.empty() == false);
+
+    return stats;
+}
+
+//relaxes every partition on its own first, with the statements that jump to other partitions kept short.
+//Those sizes are never larger than the final ones, so a second relaxation over the whole text section,
+//that first checks only the statements leaving their partition, ends in the same sizes as relaxing
+//everything at once would.
+static void relax_text(symbol_table &st,
+                       const std::vector<semantic_statements::inst_statement> &text_stmnts,
+                       std::vector<text_partition> &partitions, const std::vector<label_def> &label_defs,
+                       const std::vector<std::pair<int32_t, uint32_t>> &refs,
+                       std::vector<binary_data::memory_alloc_t> &sizes, std::vector<int> &comp_cases,
+                       std::vector<uint32_t> &addresses, const program_options &options) {
+
+    //---symbol -> referencing statements index---//
+    std::vector<uint32_t> label_stmnt(st.size(), 0);
+    for (const auto &[stmnt, symbol_id]: label_defs) label_stmnt[symbol_id] = stmnt;
+
+    //counting sort by symbol, refs are in statement order and stay so within a symbol
+    std::vector<uint32_t> symbol_refs_begin(st.size() + 1, 0);
+    for (const auto &ref: refs) symbol_refs_begin[ref.first + 1]++;
+    std::partial_sum(symbol_refs_begin.begin(), symbol_refs_begin.end(), symbol_refs_begin.begin());
+
+    //text symbol ids increase with the statement index, so are the groups
+    std::vector<uint32_t> ref_stmnts(refs.size());
+    std::vector<relax_group> groups;
+    for (int32_t symbol_id = 0; symbol_id < (int32_t) st.size(); symbol_id++) {
+        const uint32_t begin = symbol_refs_begin[symbol_id];
+        const uint32_t end = symbol_refs_begin[symbol_id + 1];
+        if (begin != end)
+            groups.push_back({.symbol_id = symbol_id,
+                              .label_stmnt = label_stmnt[symbol_id],
+                              .refs_begin = begin,
+                              .refs_end = begin});
+    }
+
+    for (const auto &[symbol_id, stmnt]: refs) ref_stmnts[symbol_refs_begin[symbol_id]++] = stmnt;
+    for (auto &group: groups) group.refs_end = symbol_refs_begin[group.symbol_id];
+
+    //---split the references of each group in those from inside and outside its partition---//
+    std::vector<std::pair<uint32_t, uint32_t>> group_intra_refs(groups.size());
+    auto group_it = groups.begin();
+    for (auto &partition: partitions) {
+        partition.first_group = group_it - groups.begin();
+        for (; group_it != groups.end() && group_it->label_stmnt < partition.last_stmnt; ++group_it) {
+            const auto refs_begin = ref_stmnts.begin() + group_it->refs_begin;
+            const auto refs_end = ref_stmnts.begin() + group_it->refs_end;
+            const auto intra_begin = std::lower_bound(refs_begin, refs_end, partition.first_stmnt);
+            const auto intra_end = std::lower_bound(intra_begin, refs_end, partition.last_stmnt);
+            group_intra_refs[group_it - groups.begin()] = {intra_begin - ref_stmnts.begin(),
+                                                           intra_end - ref_stmnts.begin()};
+        }
+        partition.last_group = group_it - groups.begin();
+    }
+
+    //---relax every partition on its own---//
+    std::vector<std::vector<relax_group>> partition_groups(partitions.size());
+    std::vector<relax_stats> partition_stats(partitions.size());
+
+    parallel_for(partitions.size(), options.jobs, [&](std::size_t p) {
+        auto &partition = partitions[p];
+        auto &local_groups = partition_groups[p];
+        for (uint32_t g = partition.first_group; g != partition.last_group; g++) {
+            const auto [intra_begin, intra_end] = group_intra_refs[g];
+            if (intra_begin != intra_end)
+                local_groups.push_back({.symbol_id = groups[g].symbol_id,
+                                        .label_stmnt = groups[g].label_stmnt,
+                                        .refs_begin = intra_begin,
+                                        .refs_end = intra_end});
+        }
+
+        //the labels of this partition are only read by statements of this partition
+        partition_stats[p] = relax_compile_cases(
+                st, text_stmnts, local_groups, ref_stmnts, addresses, sizes, comp_cases, options,
+                [&]() {
+                    const std::size_t nstmnts = partition.last_stmnt - partition.first_stmnt;
+                    binary_data::layout(std::span(sizes).subspan(partition.first_stmnt, nstmnts),
+                                        std::span(addresses).subspan(partition.first_stmnt, nstmnts),
+                                        0, 1);
+                    place_labels(partition, label_defs, addresses, st);
+                },
+                [](uint32_t) { return true; });
+    });
+
+    //---collect the statements still short and those leaving their partition---//
+    std::vector<uint32_t> text_ref_stmnts;
+    std::vector<relax_group> text_groups;
+    std::vector<char> is_cross_ref(text_stmnts.size(), false);
+    text_ref_stmnts.reserve(ref_stmnts.size());
+
+    for (std::size_t p = 0; p < partitions.size(); p++) {
+        auto local_it = partition_groups[p].begin();
+        for (uint32_t g = partitions[p].first_group; g != partitions[p].last_group; g++) {
+            const auto &group = groups[g];
+            const auto [intra_begin, intra_end] = group_intra_refs[g];
+            const uint32_t begin = text_ref_stmnts.size();
+
+            if (local_it != partition_groups[p].end() && local_it->symbol_id == group.symbol_id) {
+                text_ref_stmnts.insert(text_ref_stmnts.end(), ref_stmnts.begin() + local_it->refs_begin,
+                                       ref_stmnts.begin() + local_it->refs_end);
+                ++local_it;
+            }
+
+            for (uint32_t i = group.refs_begin; i != group.refs_end; i++) {
+                if (i == intra_begin) i = intra_end;
+                if (i == group.refs_end) break;
+
+                is_cross_ref[ref_stmnts[i]] = true;
+                text_ref_stmnts.push_back(ref_stmnts[i]);
+            }
+
+            if (begin != text_ref_stmnts.size())
+                text_groups.push_back({.symbol_id = group.symbol_id,
+                                       .label_stmnt = group.label_stmnt,
+                                       .refs_begin = begin,
+                                       .refs_end = (uint32_t) text_ref_stmnts.size()});
+        }
+    }
+
+    const int64_t ncross_refs = std::count(is_cross_ref.begin(), is_cross_ref.end(), true);
+
+    //---relax the whole text section---//
+    const auto text_stats = relax_compile_cases(
+            st, text_stmnts, text_groups, text_ref_stmnts, addresses, sizes, comp_cases, options,
+            [&]() {
+                binary_data::layout(sizes, addresses, 0, options.jobs);
+                parallel_for(partitions.size(), options.jobs, [&](std::size_t p) {
+                    place_labels(partitions[p], label_defs, addresses, st);
+                });
+            },
+            [&](uint32_t stmnt) { return is_cross_ref[stmnt] != false; });
+
+    int64_t npartition_iterations = 0, nchecks = text_stats.nchecks;
+    for (const auto &stats: partition_stats) {
+        npartition_iterations = std::max(npartition_iterations, stats.niterations);
+        nchecks += stats.nchecks;
+    }
+
+    time_report::set_counter("text partitions", (int64_t) partitions.size());
+    time_report::set_counter("partition relaxation iterations", npartition_iterations);
+    time_report::set_counter("relaxation iterations", text_stats.niterations);
+    time_report::set_counter("relaxation checks", nchecks);
+    time_report::set_counter("relaxable statements", (int64_t) refs.size());
+    time_report::set_counter("cross partition relaxable statements", ncross_refs);
+    time_report::set_counter("relaxable statements kept short",
+                             std::accumulate(text_groups.begin(), text_groups.end(), (int64_t) 0,
+                                             [](int64_t sum, const relax_group &group) {
+                                                 return sum + group.refs_end - group.refs_begin;
+                                             }));
+}
+
+static std::vector<text_layout_entry>
+get_text_layout(symbol_table &st, std::vector<semantic_statements::inst_statement> &text_stmnts,
+                std::unordered_set<identifier_table::handle> &globals,
+                std::vector<text_partition> &partitions, const program_options &options) {
 
-    binary_data::alligned_counter inst_address_counter;
     std::vector<binary_data::memory_alloc_t> sizes;
+    std::vector<label_def> label_defs;
+    partitions.push_back({.first_stmnt = 0, .first_label = 0});
+    bool split_pending = false;
 
-    //---size and label aproximation---//
+    //---worst case sizes and label insertion---//
     for (auto &inst_stmnt: text_stmnts) {
         //---get worst case instruction statement size---//
-        const auto compile_case = inst_stmnt->get_compile_case(st, 0, options);
+        const auto compile_case = inst_stmnt.get_compile_case(st, 0, options);
         //jump and branch instructions will return an undetermined compile case, the pc doesn't matter and as such can be set to 0
 
-        //---update address_counter---//
-        const auto size = inst_stmnt->get_size(compile_case);
-        const auto placement_address = inst_address_counter.increment(size);
-        sizes.push_back(size);
+        const auto size = inst_stmnt.get_size(compile_case);
+        const auto stmnt_index = (uint32_t) sizes.size();
+
+        //---a global label starts a new partition at the first word aligned statement from it on---//
+        //halfword statements in front of it stay in the previous partition
+        if (inst_stmnt.has_label() && globals.contains(inst_stmnt.get_label().identifier))
+            split_pending = true;
+
+        if (split_pending && size.allignment == binary_data::allignment_t::word) {
+            if (stmnt_index != 0) {
+                partitions.back().last_stmnt = stmnt_index;
+                partitions.back().last_label = label_defs.size();
+                partitions.push_back({.first_stmnt = stmnt_index,
+                                      .first_label = (uint32_t) label_defs.size()});
+            }
+            split_pending = false;
+        }
 
         //--insert label in symbol table---//
-        if (inst_stmnt->has_label()) {
-            const auto &identifier = inst_stmnt->get_label().identifier;
+        if (inst_stmnt.has_label()) {
+            const auto identifier = inst_stmnt.get_label().identifier;
             const bool is_global = globals.find(identifier) != globals.end();
             const symbol sym = {.section = binary::section_t::text,
                                 .identifier = identifier,
-                                .address = placement_address,
+                                .address = 0,//set by the relaxation layouts
                                 .type = symbol_type::fun,
                                 .scope = is_global ? symbol_scope::global : symbol_scope::local,
                                 .size = size.nbytes};
@@ -270,13 +582,21 @@ get_compile_cases(symbol_table &st,
             if (insert_success == false) throw std::runtime_error("duplicate label");
 
             //---set symbol id in assembly statement---//
-            inst_stmnt->get_label().symbol_id = symbol_id;
+            inst_stmnt.get_label().symbol_id = symbol_id;
+
+
+            label_defs.push_back({stmnt_index, symbol_id});
         }
+
+        sizes.push_back(size);
     }
 
+    partitions.back().last_stmnt = sizes.size();
+    partitions.back().last_label = label_defs.size();
+
     //every identifier that is still in the global set must now be an external symbol outside of the translation unit
     //must insert these into to symbol table before we can determine the compile cases
-    for (auto &identifier: globals) {
+    for (const auto identifier: globals) {
         const symbol sym = {.section = binary::section_t::undefined,
                             .identifier = identifier,
                             .address = 0,
@@ -289,94 +609,137 @@ get_compile_cases(symbol_table &st,
         if (insert_succes == false) throw std::runtime_error("duplicate global symbol");
     }
 
-    //---determine compile case with approximated text labels---//
-    std::vector<int> comp_cases;
-    inst_address_counter.reset();
-    auto size_it = sizes.begin();
-    for (auto &inst_stmnt: text_stmnts) {
-        const auto placement_address = inst_address_counter.increment(*size_it);
-        if (inst_stmnt->has_label_operand()) {
-            auto &operand_label = inst_stmnt->get_label_operand().label;
+    //---link label operands and pick the shortest compile cases---//
+    std::vector<int> comp_cases(text_stmnts.size());
+    std::vector<std::vector<std::pair<int32_t, uint32_t>>> partition_refs(partitions.size());
+
+    //the symbol table is only read here
+    parallel_for(partitions.size(), options.jobs, [&](std::size_t p) {
+        for (uint32_t i = partitions[p].first_stmnt; i != partitions[p].last_stmnt; i++) {
+            auto &inst_stmnt = text_stmnts[i];
+            if (inst_stmnt.has_label_operand() == false) {
+                //the compile case does not depend on the pc
+                comp_cases[i] = inst_stmnt.get_compile_case(st, 0, options);
+                continue;
+            }
+
+            auto &operand_label = inst_stmnt.get_label_operand().label;
 
             //---label operand symbol link---//
             //must set the symbol id of the label operand to determine compile case
             bool found_symbol = false;
             operand_label.symbol_id = st.get_id(operand_label.identifier, found_symbol);
             if (found_symbol == false) throw std::runtime_error("label not found");
-        }
 
-        /*---get final compile case---*/
-        const auto final_compile_case =
-                inst_stmnt->get_compile_case(st, placement_address, options);
-        comp_cases.push_back(final_compile_case);
-    }
+            //---text labels in this unit, start at zero distance from the label---//
+            const auto &symbol = st[operand_label.symbol_id];
+            const bool is_text_label = symbol.section == binary::section_t::text &&
+                                       symbol.scope != symbol_scope::external;
+            const auto compile_case =
+                    inst_stmnt.get_compile_case(st, is_text_label ? symbol.address : 0, options);
+            const auto size = inst_stmnt.get_size(compile_case);
 
-    return comp_cases;
-}
+            //statements that are as large as their worst case can not grow
+            if (is_text_label && size.nbytes < sizes[i].nbytes)
+                partition_refs[p].push_back({operand_label.symbol_id, i});
 
-static void calculate_text_label_addresses(
-        std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_stmnts,
-        const std::vector<int> &compile_cases, symbol_table &st) {
+            comp_cases[i] = compile_case;
+            sizes[i] = size;
+        }
+    });
+
+    std::vector<std::pair<int32_t, uint32_t>> relax_refs;//symbol id, statement index
+    for (const auto &refs: partition_refs) relax_refs.insert(relax_refs.end(), refs.begin(), refs.end());
+
+    std::vector<uint32_t> addresses(text_stmnts.size());
+    relax_text(st, text_stmnts, partitions, label_defs, relax_refs, sizes, comp_cases, addresses,
+               options);
+
+    //---the compile cases are final, fill the layout table---//
+    std::vector<text_layout_entry> layout(text_stmnts.size());
+    parallel_for(partitions.size(), options.jobs, [&](std::size_t p) {
+        for (uint32_t i = partitions[p].first_stmnt; i != partitions[p].last_stmnt; i++) {
+            assert(comp_cases[i] != 0);
+            layout[i] = {.address = addresses[i],
+                         .compile_case = (uint16_t) comp_cases[i],
+                         .nbytes = (uint8_t) sizes[i].nbytes,
+                         .allignment = sizes[i].allignment};
+        }
+    });
 
-    binary_data::alligned_counter inst_address_counter;
-    auto compile_case_it = compile_cases.begin();
+    return layout;
+}
 
-    for (auto &inst_stmnt: text_stmnts) {
-        /*---update address counter---*/
-        assert(compile_case_it != compile_cases.end());
-        assert(*compile_case_it != 0);
-        const auto size = inst_stmnt->get_size(*compile_case_it);
-        const auto placement_address = inst_address_counter.increment(size);
-        ++compile_case_it;
-
-        /*---update label address---*/
-        if (inst_stmnt->has_label()) {
-            const auto symbol_id = inst_stmnt->get_label().symbol_id;
-            st[symbol_id].address = placement_address;
-            st[symbol_id].size = size.nbytes;
+static void calculate_text_label_addresses(
+        std::vector<semantic_statements::inst_statement> &text_stmnts,
+        const std::vector<text_layout_entry> &layout, const std::vector<text_partition> &partitions,
+        symbol_table &st, unsigned njobs) {
+
+    //the labels of every partition are disjoint
+    parallel_for(partitions.size(), njobs, [&](std::size_t p) {
+        for (uint32_t i = partitions[p].first_stmnt; i != partitions[p].last_stmnt; i++) {
+            auto &inst_stmnt = text_stmnts[i];
+
+            /*---update label address---*/
+            if (inst_stmnt.has_label()) {
+                const auto symbol_id = inst_stmnt.get_label().symbol_id;
+                st[symbol_id].address = layout[i].address;
+                st[symbol_id].size = layout[i].nbytes;
+            }
         }
-    }
+    });
 }
 
-std::vector<isa::instruction>
-generate_instructions(std::vector<std::unique_ptr<semantic_statements::inst_statement_i>> &text_stmnts,
-                      const std::vector<int> &compile_cases, symbol_table &st) {
-
-    std::vector<isa::instruction> instructions;
-    binary_data::alligned_counter inst_counter;
-    auto compile_case_it = compile_cases.begin();
-
-    for (auto &inst_stmnt: text_stmnts) {
-        //---update address counter---//
-        assert(*compile_case_it != 0);
-        assert(compile_case_it != compile_cases.end());
-        const auto size = inst_stmnt->get_size(*compile_case_it);
-        const auto placement_address = inst_counter.increment(size);
-
-        //---generate instruction---//
-        const std::vector<isa::instruction> generated_instructions =
-                inst_stmnt->gen_instructions(*compile_case_it, st, placement_address);
-
-        instructions.insert(instructions.end(), generated_instructions.begin(),
-                            generated_instructions.end());
-
-        //---insert symbol reference---//
-        if (inst_stmnt->has_label_operand()) {
-            st.insert_ref({.symbol_id = inst_stmnt->get_label_operand().label.symbol_id,
-                           .address = placement_address,
-                           .type = inst_stmnt->get_reloc_type(*compile_case_it, st)});
+std::vector<uint8_t>
+generate_text(const std::vector<semantic_statements::inst_statement> &text_stmnts,
+              const std::vector<text_layout_entry> &layout, symbol_table &st, unsigned njobs) {
+    static constexpr std::size_t chunk_size = 1 << 12;
+
+    //---the text section ends at the end of the last statement---//
+    const uint32_t text_size = layout.empty() ? 0 : layout.back().address + layout.back().nbytes;
+
+    //alignment padding stays zero
+    std::vector<uint8_t> text(text_size, 0);
+
+    //every statement only writes its own bytes, so chunks are encoded independently.
+    //The symbol table is only read, references are collected per chunk and inserted in statement order
+    const std::size_t nchunks = (text_stmnts.size() + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<symbol_ref>> chunk_refs(nchunks);
+
+    parallel_for(nchunks, njobs, [&](std::size_t c) {
+        const std::size_t last = std::min((c + 1) * chunk_size, text_stmnts.size());
+        for (std::size_t i = c * chunk_size; i < last; i++) {
+            const auto &inst_stmnt = text_stmnts[i];
+            const auto &entry = layout[i];
+
+            //---generate and encode instructions---//
+            //they are encoded straight into the section, no instruction list is kept
+            const semantic_statements::inst_buffer generated_instructions =
+                    inst_stmnt.gen_instructions(entry.compile_case, st, entry.address);
+
+            [[maybe_unused]] const uint32_t end =
+                    isa::encode_many(generated_instructions, text.data(), entry.address);
+            assert(end <= entry.address + entry.nbytes);
+
+            //---collect symbol reference---//
+            if (inst_stmnt.has_label_operand()) {
+                chunk_refs[c].push_back({.symbol_id = inst_stmnt.get_label_operand().label.symbol_id,
+                                         .address = entry.address,
+                                         .type = inst_stmnt.get_reloc_type(entry.compile_case, st)});
+            }
         }
+    });
 
-        ++compile_case_it;
-    }
+    for (const auto &refs: chunk_refs)
+        for (const auto &ref: refs) st.insert_ref(ref);
 
-    return instructions;
+    return text;
 }
 
 std::vector<binary_data::data_alloc_t>
 process_data_directives(binary::section_t section,
                         const std::vector<semantic_statements::data_directive> &data_stmnts, symbol_table &st,
-                        std::unordered_set<std::string> &globals) {
+                        std::unordered_set<identifier_table::handle> &globals) {
 
     std::vector<binary_data::data_alloc_t> data;
     binary_data::alligned_counter data_counter;
@@ -409,3 +772,85 @@ process_data_directives(binary::section_t section,
 
     return data;
 }
+
+static uint32_t section_size(const std::vector<binary_data::data_alloc_t> &data_allocs) {
+    binary_data::alligned_counter counter;
+    for (const auto &data_alloc: data_allocs) counter.increment(data_alloc.memory_alloc);
+    return counter.get_count();
+}
+
+static uint32_t section_size(const std::vector<semantic_statements::data_directive> &data_stmnts) {
+    binary_data::alligned_counter counter;
+    for (const auto &data_stmnt: data_stmnts) counter.increment(data_stmnt.get_size());
+    return counter.get_count();
+}
+
+//moves zero initialised objects from .data to the end of .bss. An object is a labeled directive
+//and the unlabeled ones that follow it, it only moves when all of them are zero data.
+//Unlabeled directives before the first label stay. Returns by how many bytes .data shrank
+static uint32_t promote_zero_data(std::vector<semantic_statements::data_directive> &data,
+                                  std::vector<semantic_statements::data_directive> &bss) {
+    const uint32_t old_size = section_size(data);
+
+    std::vector<semantic_statements::data_directive> kept;
+    kept.reserve(data.size());
+
+    auto object_begin = data.begin();
+    while (object_begin != data.end()) {
+        const auto object_end = std::find_if(object_begin + 1, data.end(),
+                                             [](const auto &stmnt) { return stmnt.has_label(); });
+
+        const bool is_zero = object_begin->has_label() &&
+                             std::all_of(object_begin, object_end,
+                                         [](const auto &stmnt) { return stmnt.get_data().zero_data; });
+
+        auto &target = is_zero ? bss : kept;
+        target.insert(target.end(), std::make_move_iterator(object_begin), std::make_move_iterator(object_end));
+        object_begin = object_end;
+    }
+
+    data = std::move(kept);
+    return old_size - section_size(data);
+}
+
+//.text stays at 0, so text addresses and pc relative offsets are already final.
+//.rodata and .data start on the following pages, .bss directly follows .data and shares its segment
+static binary::section_addresses exec_section_addresses(const compilation_unit &comp_unit) {
+    const auto &layout = comp_unit.text_layout;
+    const uint64_t text_size = layout.empty() ? 0 : layout.back().address + layout.back().nbytes;
+
+    const auto page_allign = [](uint64_t address) {
+        return (address + binary::page_size - 1) / binary::page_size * binary::page_size;
+    };
+
+    const uint64_t rodata = page_allign(text_size);
+    const uint64_t data = page_allign(rodata + section_size(comp_unit.rodata));
+    const uint64_t bss = (data + section_size(comp_unit.data) + 3) / 4 * 4;//word aligned like the section
+    if (bss + section_size(comp_unit.bss) > UINT32_MAX)
+        throw std::runtime_error("sections do not fit in the address space");
+
+    return {.text = 0, .rodata = (uint32_t) rodata, .data = (uint32_t) data, .bss = (uint32_t) bss};
+}
+
+//turns section offsets of defined data symbols into virtual addresses
+static void rebase_symbols(symbol_table &st, const binary::section_addresses &addresses) {
+    for (auto &sym: st) {
+        if (sym.scope == symbol_scope::external) continue;
+
+        switch (sym.section) {
+            case binary::section_t::rodata:
+                sym.address += addresses.rodata;
+                break;
+            case binary::section_t::data:
+                sym.address += addresses.data;
+                break;
+            case binary::section_t::bss:
+                sym.address += addresses.bss;
+                break;
+            case binary::section_t::text:
+            case binary::section_t::undefined:
+            case binary::section_t::LAST:
+                break;
+        }
+    }
+}
@@ -95,7 +95,7 @@ const static enum_lut<asm_lang::data_statement_id, std::pair<isa::inst_id, bool>
                 {asm_lang::data_statement_id::Lbu, {isa::inst_id::Lbu, true}},
         });
 
-std::vector<isa::instruction>
+semantic_statements::inst_buffer
 semantic_statements::data_statement::gen_instructions(int comp_case_int, const symbol_table &st,
                                                       uint32_t pc) const {
     const auto comp_case = (compile_case_t) comp_case_int;
@@ -288,7 +288,7 @@ binary_data::memory_alloc_t semantic_statements::jump_statement::get_size(int co
     assert(!"unreachable");
 }
 
-std::vector<isa::instruction>
+semantic_statements::inst_buffer
 semantic_statements::jump_statement::gen_instructions(int comp_case_int, const symbol_table &st,
                                                       uint32_t pc) const {
     const auto comp_case = (compile_case_t) comp_case_int;
@@ -387,15 +387,15 @@ int semantic_statements::branch_statement::get_compile_case(const symbol_table &
         throw std::runtime_error("cannot branch to external symbol");
 
 
+    //pc and the symbol address are final once relaxation settles, no worst case margin is needed
     const int32_t jump_offset = symbol.address - pc;
-    const int32_t worst_casa_address = (jump_offset < 0) ? jump_offset - 4 : jump_offset;
 
     //the least significant bit of the address is always zero,
     //the immediate operand in a branch instructions doesn't include this least significant bit, so 1 is subtracted from the needed bitwidth
-    const auto offset_bitwidth = signed_bitwidth(worst_casa_address) - 1;
+    const auto offset_bitwidth = signed_bitwidth(jump_offset) - 1;
 
     if (offset_bitwidth <=
-        isa::branch_lowerimmediate_bitsize + isa::branch_lowerimmediate_bitsize) {
+        isa::branch_lowerimmediate_bitsize + isa::branch_upperimmediate_bitsize) {
         return (int) compile_case_t::short_branch;
     }
 
@@ -433,7 +433,7 @@ const enum_lut<asm_lang::branch_statement_id, isa::inst_id> branch_stmnt_reverse
          {asm_lang::branch_statement_id::Bgru, isa::inst_id::Bgeu},
          {asm_lang::branch_statement_id::Bgeu, isa::inst_id::Bgru}});
 
-std::vector<isa::instruction>
+semantic_statements::inst_buffer
 semantic_statements::branch_statement::gen_instructions(int comp_case_int, const symbol_table &st,
                                                         uint32_t pc) const {
     const auto comp_case = (compile_case_t) comp_case_int;
@@ -456,8 +456,9 @@ semantic_statements::branch_statement::gen_instructions(int comp_case_int, const
             //Example !(a >= b) = (a < b) = (b > a)
             //Example !(a == b) = (a != b) = (b != a) here register swapping is not necessary but is done anyway for consistency
 
+            //the branch skips the 4 byte branch and the 4 byte jump
             const isa::inst_id branch_inst_id = branch_stmnt_reverse_inst_id_lut[id];
-            return {isa::make_branch_inst(branch_inst_id, operand2, operand1, 4),
+            return {isa::make_branch_inst(branch_inst_id, operand2, operand1, 8),
                     isa::make_jump_inst(isa::inst_id::Rji, (jump_offset - 4))};
             //jump instruction is places 4 bytes further than then what the offset is calculated for, these 4 bytes have to be subtracted
         }
@@ -522,7 +523,7 @@ semantic_statements::unary_statement::get_size(int comp_case_int) const {
     assert(!"unreachable");
 }
 
-std::vector<isa::instruction>
+semantic_statements::inst_buffer
 semantic_statements::unary_statement::gen_instructions(int comp_case_int, const symbol_table &st,
                                                        uint32_t pc) const {
     auto comp_case = (compile_case_t) comp_case_int;
@@ -637,7 +638,7 @@ binary_data::memory_alloc_t semantic_statements::set_statement::get_size(int com
 }
 
 
-std::vector<isa::instruction>
+semantic_statements::inst_buffer
 semantic_statements::set_statement::gen_instructions(int comp_case_int, const symbol_table &st,
                                                      uint32_t pc) const {
     const auto comp_case = (compile_case_t) comp_case_int;
@@ -797,7 +798,7 @@ semantic_statements::reg_arith_statement::get_size(int comp_case_int) const {
     assert(!"unreachable");
 }
 
-std::vector<isa::instruction> semantic_statements::reg_arith_statement::gen_instructions(
+semantic_statements::inst_buffer semantic_statements::reg_arith_statement::gen_instructions(
         int comp_case_int, const symbol_table &st, uint32_t pc) const {
     const auto comp_case = (compile_case_t) comp_case_int;
     switch (comp_case) {
@@ -846,7 +847,7 @@ public:
     };
 };
 
-std::vector<isa::instruction>
+semantic_statements::inst_buffer
 semantic_statements::reg_arith_statement::gen_fullword_instructions() const {
     const static fullword_reg_inst_lut lut;
 
@@ -891,7 +892,7 @@ public:
     };
 };
 
-std::vector<isa::instruction>
+semantic_statements::inst_buffer
 semantic_statements::reg_arith_statement::gen_halfword_instructions() const {
     static const halfword_reg_inst_lut lut;
 
@@ -1008,6 +1009,7 @@ class imm_stmnt_to_imm_inst {
 
 public:
     imm_stmnt_to_imm_inst() {
+        lut[(int) asm_stmnt_id::Andi] = isa::inst_id::Andi;
         lut[(int) asm_stmnt_id::Xori] = isa::inst_id::Xori;
         lut[(int) asm_stmnt_id::Ori] = isa::inst_id::Ori;
         lut[(int) asm_stmnt_id::Addi] = isa::inst_id::Addi;
@@ -1026,13 +1028,12 @@ public:
     };
 };
 
-std::vector<isa::instruction> semantic_statements::immediate_arith_statement::gen_instructions(
+semantic_statements::inst_buffer semantic_statements::immediate_arith_statement::gen_instructions(
         int comp_case_int, const symbol_table &st, uint32_t pc) const {
     static const imm_stmnt_to_imm_inst fullword_imm_lut;
     const auto comp_case = (compile_case_t) comp_case_int;
     assert(comp_case != compile_case_t::undetermined);
 
-    std::vector<isa::instruction> instructions;
     switch (comp_case) {
         case compile_case_t::fullword: {
             const auto inst_id = fullword_imm_lut[id];
@@ -1063,7 +1064,7 @@ semantic_statements::asm_statement::asm_statement(syntax::statement &&syn_stmnt)
     switch (syn_stmnt.type) {
         case syntax::statement_type::inst:
             type_m = types::instruction_statement;
-            produce_inst_statement(std::move(syn_stmnt), inst_stmnt_ptr_m);
+            inst_stmnt_m.emplace(produce_inst_statement(syn_stmnt));
             break;
         case syntax::statement_type::dir:
             type_m = types::directive_statement;
@@ -1072,56 +1073,43 @@ semantic_statements::asm_statement::asm_statement(syntax::statement &&syn_stmnt)
     }
 }
 
-void semantic_statements::asm_statement::produce_inst_statement(
-        syntax::statement &&syn_inst_stmnt,
-        std::unique_ptr<semantic_statements::inst_statement_i> &stmnt_ptr) {
-
-    asm_lang::inst_statement_info info;
-    if (asm_lang::string_to_instruction_info(syn_inst_stmnt.mnemonic, info) == false) assert(false);
-
-    switch (info.type) {
-        case asm_lang::inst_statement_type::reg_arith:
-            stmnt_ptr = std::move(std::make_unique<semantic_statements::reg_arith_statement>(
-                    syn_inst_stmnt, info.reg_arith));
-            break;
-        case asm_lang::inst_statement_type::imm_arith:
-            stmnt_ptr = std::move(std::make_unique<semantic_statements::immediate_arith_statement>(
-                    syn_inst_stmnt, info.imm_arith));
-            break;
-        case asm_lang::inst_statement_type::unary:
-            stmnt_ptr = std::move(std::make_unique<semantic_statements::unary_statement>(
-                    syn_inst_stmnt, info.unary));
-            break;
-        case asm_lang::inst_statement_type::set:
-            stmnt_ptr = std::move(
-                    std::make_unique<semantic_statements::set_statement>(syn_inst_stmnt, info.set));
-            break;
-        case asm_lang::inst_statement_type::jump:
-            stmnt_ptr = std::move(std::make_unique<semantic_statements::jump_statement>(
-                    syn_inst_stmnt, info.jump));
-            break;
-        case asm_lang::inst_statement_type::branch:
-            stmnt_ptr = std::move(std::make_unique<semantic_statements::branch_statement>(
-                    syn_inst_stmnt, info.branch));
-            break;
-        case asm_lang::inst_statement_type::data:
-            stmnt_ptr = std::move(std::make_unique<semantic_statements::data_statement>(
-                    syn_inst_stmnt, info.data));
-            break;
-        default:
-            assert(!"unreachable");
-    }
+semantic_statements::inst_statement semantic_statements::asm_statement::produce_inst_statement(
+        const syntax::statement &syn_inst_stmnt) {
+
+    const asm_lang::inst_statement_info &info = syn_inst_stmnt.mnemonic;
+
+    auto stmnt = [&]() -> semantic_statements::inst_statement {
+        switch (info.type) {
+            case asm_lang::inst_statement_type::reg_arith:
+                return semantic_statements::reg_arith_statement(syn_inst_stmnt, info.reg_arith);
+            case asm_lang::inst_statement_type::imm_arith:
+                return semantic_statements::immediate_arith_statement(syn_inst_stmnt, info.imm_arith);
+            case asm_lang::inst_statement_type::unary:
+                return semantic_statements::unary_statement(syn_inst_stmnt, info.unary);
+            case asm_lang::inst_statement_type::set:
+                return semantic_statements::set_statement(syn_inst_stmnt, info.set);
+            case asm_lang::inst_statement_type::jump:
+                return semantic_statements::jump_statement(syn_inst_stmnt, info.jump);
+            case asm_lang::inst_statement_type::branch:
+                return semantic_statements::branch_statement(syn_inst_stmnt, info.branch);
+            case asm_lang::inst_statement_type::data:
+                return semantic_statements::data_statement(syn_inst_stmnt, info.data);
+            default:
+                assert(!"unreachable");
+                throw std::runtime_error("unknown instruction statement type");
+        }
+    }();
 
     //---set inst label---//
-    if (syn_inst_stmnt.label.size() != 0) stmnt_ptr->set_label(std::move(syn_inst_stmnt.label));
+    if (syn_inst_stmnt.label != identifier_table::none) stmnt.set_label(syn_inst_stmnt.label);
+
+    return stmnt;
 }
 
 
 semantic_statements::directive_statement::directive_statement(
         const syntax::statement &syn_dir) {
-    asm_lang::directive_info dir_info;
-    if (asm_lang::string_to_directive_info(syn_dir.directive, dir_info) == false)
-        throw std::runtime_error(std::string{"unknown directive: "} + syn_dir.directive);
+    const asm_lang::directive_info &dir_info = syn_dir.directive;
 
     //---set directive by type--//
     type_m = dir_info.type;
@@ -1157,7 +1145,7 @@ semantic_statements::directive_statement::directive_statement(
             if (syn_dir.args[0].type != syntax::arg_type::label)
                 throw std::runtime_error("expected label argument");
 
-            symbol_m.identifier = syn_dir.args[0].str_val;
+            symbol_m.identifier = syn_dir.args[0].label_val;
 
             break;
         default:
@@ -1170,7 +1158,7 @@ semantic_statements::data_directive::data_directive(const syntax::statement &syn
     const auto &args = syn_stmnt.args;
 
     //---set label--//
-    if (syn_stmnt.label.size() != 0) {
+    if (syn_stmnt.label != identifier_table::none) {
         has_label_m = true;
         label_m = {syn_stmnt.label};
     } else {
@@ -1215,7 +1203,8 @@ semantic_statements::data_directive::data_directive(const syntax::statement &syn
             data.memory_alloc = {.nbytes = word_size(allignment) * n_values,
                                  .allignment = allignment};
 
-            bool is_zero_data = (args.size() == 0);
+            //no arguments is an implicit zero
+            bool is_zero_data = true;
             for (auto &arg: args) {
                 is_zero_data = (is_zero_data && arg.int_val == 0);
                 if (arg.type != syntax::arg_type::integer)
@@ -0,0 +1,319 @@
+#include "simd_scanner.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "lexer.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+using types = lexer::token::types;
+
+static const std::size_t window_size = 1 << 16;
+
+//---character classes of F.l---//
+//[A-z] also covers [\]^_` like the flex rule does
+static bool is_alpha(char c) { return c >= 'A' && c <= 'z'; }
+static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+static bool is_ident(char c) { return is_alpha(c) || is_digit(c); }
+static bool is_bit(char c) { return c == '0' || c == '1'; }
+static bool is_hex(char c) {
+    return is_digit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+static bool is_blank(char c) { return c == ' ' || c == '\t'; }
+
+//---simd character class masks, bit i is set when it[i] is in the class---//
+#if defined(__AVX2__)
+static const std::ptrdiff_t simd_width = 32;
+static const uint32_t simd_full_mask = 0xffffffff;
+
+static uint32_t ident_mask(const char *it) {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(it));
+    //signed compares, bytes >= 0x80 are negative and fall outside both ranges
+    const __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('A' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), chunk));
+    const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('0' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chunk));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(alpha, digit)));
+}
+
+static uint32_t blank_mask(const char *it) {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(it));
+    const __m256i blank = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')),
+                                          _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t')));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(blank));
+}
+#elif defined(__SSE2__)
+static const std::ptrdiff_t simd_width = 16;
+static const uint32_t simd_full_mask = 0xffff;
+
+static uint32_t ident_mask(const char *it) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(it));
+    //signed compares, bytes >= 0x80 are negative and fall outside both ranges
+    const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('A' - 1)),
+                                        _mm_cmplt_epi8(chunk, _mm_set1_epi8('z' + 1)));
+    const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmplt_epi8(chunk, _mm_set1_epi8('9' + 1)));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(alpha, digit)));
+}
+
+static uint32_t blank_mask(const char *it) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(it));
+    const __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                                       _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t')));
+    return static_cast<uint32_t>(_mm_movemask_epi8(blank));
+}
+#endif
+
+//returns the end of the run of identifier characters starting at it
+static const char *skip_ident(const char *it, const char *end) {
+#if defined(__AVX2__) || defined(__SSE2__)
+    for (; end - it >= simd_width; it += simd_width) {
+        const uint32_t stop = ~ident_mask(it) & simd_full_mask;
+        if (stop != 0) return it + __builtin_ctz(stop);
+    }
+#endif
+    while (it != end && is_ident(*it)) ++it;
+    return it;
+}
+
+//returns the end of the run of spaces and tabs starting at it
+static const char *skip_blanks(const char *it, const char *end) {
+#if defined(__AVX2__) || defined(__SSE2__)
+    for (; end - it >= simd_width; it += simd_width) {
+        const uint32_t stop = ~blank_mask(it) & simd_full_mask;
+        if (stop != 0) return it + __builtin_ctz(stop);
+    }
+#endif
+    while (it != end && is_blank(*it)) ++it;
+    return it;
+}
+
+//F.l also lexes r0-r3 as registers, the isa has no registers by those names
+static bool is_numbered_register(std::string_view word) {
+    return word.size() == 2 && word[0] == 'r' && word[1] >= '0' && word[1] <= '3';
+}
+
+//---simd_scanner---//
+simd_scanner::simd_scanner(std::string_view source)
+    : pos_m(source.data()), end_m(source.data() + source.size()), input_done_m(true) {}
+
+simd_scanner::simd_scanner(ring_buffer &source)
+    : source_ring_m(&source), window_m(window_size), input_done_m(false) {
+    pos_m = end_m = window_m.data();
+}
+
+char simd_scanner::peek(const char *it) {
+    if (it < end_m) return *it;
+
+    //a rule wants to look past the window, the token has to be scanned again after a refill
+    if (input_done_m == false) hit_end_m = true;
+    return '\0';
+}
+
+bool simd_scanner::refill() {
+    if (input_done_m) return false;
+
+    //---move the unscanned tail to the front, grow when a single token fills the window---//
+    const std::size_t nkept = end_m - pos_m;
+    std::memmove(window_m.data(), pos_m, nkept);
+    if (nkept == window_m.size()) window_m.resize(window_m.size() * 2);
+
+    //---fill the window, so tokens are not rescanned for every small write of the producer---//
+    std::size_t nfilled = nkept;
+    while (nfilled != window_m.size()) {
+        const std::size_t nread =
+                source_ring_m->read(window_m.data() + nfilled, window_m.size() - nfilled);
+        if (nread == 0) {
+            input_done_m = true;
+            break;
+        }
+        nfilled += nread;
+    }
+
+    pos_m = window_m.data();
+    end_m = window_m.data() + nfilled;
+    return true;
+}
+
+//resolves the word to a register or mnemonic, F.l matches whole words only
+int simd_scanner::classify_word(std::string_view word) {
+    if (const auto reg = isa::string_to_reg_id_map.find(word)) {
+        reg_m = *reg;
+        return (int) types::reg;
+    }
+
+    if (is_numbered_register(word)) {
+        reg_m = isa::reg_id::LAST;
+        return (int) types::reg;
+    }
+
+    //F.l lists the same mnemonics as the instruction table
+    if (const auto info = asm_lang::string_to_instruction_map.find(word)) {
+        mnemonic_m = *info;
+        return (int) types::mnemonic;
+    }
+
+    return (int) types::label;
+}
+
+const char *simd_scanner::scan_identifier(const char *it) {
+    it = skip_ident(it + 1, end_m);
+    peek(it);
+    return it;
+}
+
+//returns nullptr when no number rule matches
+const char *simd_scanner::scan_number(const char *it) {
+    const char *digits = it;
+    if (*digits == '-') ++digits;
+    if (is_digit(peek(digits)) == false) return nullptr;
+
+    //---decimal, a hex or binary match is always longer when there is one---//
+    const char *end = digits + 1;
+    while (is_digit(peek(end))) ++end;
+
+    if (*digits == '0' && end == digits + 1) {
+        const char prefix = peek(digits + 1);
+        const char *prefixed_end = digits + 2;
+        if (prefix == 'x')
+            while (is_hex(peek(prefixed_end))) ++prefixed_end;
+        else if (prefix == 'b')
+            while (is_bit(peek(prefixed_end))) ++prefixed_end;
+
+        if (prefixed_end != digits + 2) end = prefixed_end;
+    }
+
+    return end;
+}
+
+//returns nullptr when the string is not terminated
+const char *simd_scanner::scan_string(const char *it) {
+    ++it;
+    for (;;) {
+        const char c = peek(it);
+        if (it >= end_m) return nullptr;
+
+        if (c == '"') return it + 1;
+
+        if (c == '\\') {
+            //an escape covers any character except a newline
+            const char escaped = peek(it + 1);
+            if (it + 1 >= end_m || escaped == '\n') return nullptr;
+            it += 2;
+        } else {
+            ++it;
+        }
+    }
+}
+
+//scans one token starting at start, returns its type, a none token for text flex skips
+int simd_scanner::scan_token(const char *start, const char *&token_end) {
+    const char c = *start;
+    token_end = start + 1;
+
+    if (is_alpha(c)) {
+        token_end = scan_identifier(start);
+        //a word cut off by the window end is classified again after the refill
+        return classify_word(std::string_view(start, token_end - start));
+    }
+
+    if (is_digit(c) || c == '-') {
+        const char *end = scan_number(start);
+        if (end == nullptr) return (int) types::none;
+
+        token_end = end;
+        const char *digits = start + (c == '-' ? 1 : 0);
+        if (end - digits > 2 && digits[1] == 'x') return (int) types::hex_integer;
+        if (end - digits > 2 && digits[1] == 'b') return (int) types::binary_integer;
+        return (int) types::decimal_integer;
+    }
+
+    switch (c) {
+        case '\n':
+            while (peek(token_end) == '\n') ++token_end;
+            return (int) types::newline;
+
+        case ',':
+            return (int) types::comma;
+
+        case ':':
+            return (int) types::collon;
+
+        case '"': {
+            const char *end = scan_string(start);
+            if (end == nullptr) return (int) types::none;
+            token_end = end;
+            return (int) types::string;
+        }
+
+        case '.':
+            if (is_ident(peek(start + 1)) == false) return (int) types::none;
+            token_end = skip_ident(start + 1, end_m);
+            peek(token_end);
+            directive_m = asm_lang::string_to_directive_map.find(
+                    std::string_view(start, token_end - start));
+            return (int) types::directive;
+
+        case '\'':
+            //'.' in flex, any character except a newline between the quotes
+            if (peek(start + 1) == '\n' || start + 1 >= end_m || peek(start + 2) != '\'')
+                return (int) types::none;
+            token_end = start + 3;
+            return (int) types::ch;
+
+        case '/': {
+            if (peek(start + 1) != '/') return (int) types::none;
+
+            //a comment runs up to, not including, the newline
+            const void *newline = std::memchr(start + 2, '\n', end_m - (start + 2));
+            if (newline == nullptr) {
+                token_end = end_m;
+                peek(end_m);
+            } else {
+                token_end = static_cast<const char *>(newline);
+            }
+            return (int) types::none;
+        }
+
+        default:
+            return (int) types::none;
+    }
+}
+
+int simd_scanner::scan() {
+    for (;;) {
+        pos_m = skip_blanks(pos_m, end_m);
+
+        if (pos_m == end_m) {
+            if (refill()) continue;
+
+            token_m = pos_m;
+            token_size_m = 0;
+            return (int) types::eof;
+        }
+
+        hit_end_m = false;
+        const char *token_end;
+        const int type = scan_token(pos_m, token_end);
+
+        //the token may continue in input that has not been read yet
+        if (hit_end_m) {
+            refill();
+            continue;
+        }
+
+        token_m = pos_m;
+        token_size_m = token_end - pos_m;
+        pos_m = token_end;
+
+        if (type == (int) types::newline || type == (int) types::string)
+            line_m += (int) std::count(token_m, token_end, '\n');
+
+        if (type != (int) types::none) return type;
+    }
+}
@@ -0,0 +1,82 @@
+#include "source_buffer.h"
+
+#include <cstdlib>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+source_buffer::source_buffer(source_buffer &&other) noexcept
+    : data_m(std::exchange(other.data_m, nullptr)), size_m(std::exchange(other.size_m, 0)),
+      storage_m(std::exchange(other.storage_m, storage_t::none)) {}
+
+source_buffer &source_buffer::operator=(source_buffer &&other) noexcept {
+    if (this != &other) {
+        release();
+        data_m = std::exchange(other.data_m, nullptr);
+        size_m = std::exchange(other.size_m, 0);
+        storage_m = std::exchange(other.storage_m, storage_t::none);
+    }
+
+    return *this;
+}
+
+void source_buffer::release() {
+    switch (storage_m) {
+        case storage_t::mapped:
+            munmap(const_cast<char *>(data_m), size_m);
+            break;
+        case storage_t::heap:
+            free(const_cast<char *>(data_m));
+            break;
+        case storage_t::none:
+            break;
+    }
+
+    data_m = nullptr;
+    size_m = 0;
+    storage_m = storage_t::none;
+}
+
+source_buffer source_buffer::map_file(const std::filesystem::path &path) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("could not read input file");
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw std::runtime_error("could not stat input file");
+    }
+
+    source_buffer buffer;
+
+    //an empty file can't be mapped, an empty view is returned instead
+    if (file_stat.st_size != 0) {
+        void *mapping = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("could not map input file");
+        }
+
+        //the source is read front to back exactly once
+        madvise(mapping, file_stat.st_size, MADV_SEQUENTIAL);
+
+        buffer.data_m = static_cast<const char *>(mapping);
+        buffer.size_m = file_stat.st_size;
+        buffer.storage_m = storage_t::mapped;
+    }
+
+    //the mapping stays valid after the descriptor is closed
+    close(fd);
+    return buffer;
+}
+
+source_buffer source_buffer::adopt_heap(char *data, std::size_t size) {
+    source_buffer buffer;
+    buffer.data_m = data;
+    buffer.size_m = size;
+    buffer.storage_m = storage_t::heap;
+    return buffer;
+}
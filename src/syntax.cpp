@@ -6,9 +6,30 @@
 #include "syntax.h"
 #include "address_counter.h"
 #include "isa.h"
+#include <charconv>
 #include <cstdint>
+#include <limits>
 
-static std::pair<int64_t, bool> try_parse_int(lexer::token tk) {
+static int64_t parse_integer(const std::string_view token_text, int base) {
+    std::string_view text = token_text;
+    const bool negative = text.starts_with('-');
+    if (negative) text.remove_prefix(1);
+
+    //skip the 0x/0b prefix, the lexer guarantees it is there
+    if (base != 10) text.remove_prefix(2);
+
+    uint64_t magnitude = 0;
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), magnitude, base);
+
+    //the magnitude has to fit an int64_t, -2^63 is the one value that only fits negated
+    const uint64_t max_magnitude = (uint64_t) std::numeric_limits<int64_t>::max() + negative;
+    if (result.ec != std::errc{} || magnitude > max_magnitude)
+        throw std::runtime_error(std::string{"integer out of range: "} + std::string{token_text});
+
+    return negative ? (int64_t) (0 - magnitude) : (int64_t) magnitude;
+}
+
+static std::pair<int64_t, bool> try_parse_int(const lexer::token &tk) {
     using token_type = lexer::token::types;
 
     int64_t int_val = 0;
@@ -18,15 +39,15 @@ static std::pair<int64_t, bool> try_parse_int(lexer::token tk) {
             break;
 
         case token_type::binary_integer:
-            int_val = std::stol(tk.get_text(), nullptr, 2);
+            int_val = parse_integer(tk.get_text(), 2);
             break;
 
         case token_type::decimal_integer:
-            int_val = std::stol(tk.get_text(), nullptr, 10);
+            int_val = parse_integer(tk.get_text(), 10);
             break;
 
         case token_type::hex_integer:
-            int_val = std::stol(tk.get_text(), nullptr, 16);
+            int_val = parse_integer(tk.get_text(), 16);
             break;
 
         default:
@@ -36,68 +57,68 @@ static std::pair<int64_t, bool> try_parse_int(lexer::token tk) {
     return {int_val, true};
 }
 
-static std::pair<syntax::arg, bool> try_parse_arg(lexer::token tk) {
+static std::pair<syntax::arg, bool> try_parse_arg(const lexer::token &tk,
+                                                  std::pmr::memory_resource *arena) {
     using token_type = lexer::token::types;
-    syntax::arg_type type;
 
     const auto [int_val, is_int] = try_parse_int(tk);
     if (is_int)
-	type = syntax::arg_type::integer;
-    else {
-        switch (tk.get_type()) {
+        return {syntax::arg {syntax::arg_type::integer, {}, int_val}, true};
+
+    //the type is set by the token switch below
+    syntax::arg argument {.type = syntax::arg_type::integer, .str_val = {}, .int_val = int_val};
+    switch (tk.get_type()) {
         case token_type::label:
-            type = syntax::arg_type::label;
+            argument.type = syntax::arg_type::label;
+            argument.label_val = tk.get_label();
             break;
 
         case token_type::string:
-            type = syntax::arg_type::string;
+            //only string arguments keep their text
+            argument.type = syntax::arg_type::string;
+            argument.str_val = std::pmr::string(tk.get_text(), arena);
             break;
 
         case token_type::reg:
-            type = syntax::arg_type::reg;
+            argument.type = syntax::arg_type::reg;
+            argument.reg_val = tk.get_reg();
             break;
 
         default:
             return {syntax::arg{}, false};
-        }
     }
 
-    const auto argument = syntax::arg {type, tk.get_text(), int_val};
-    return {argument, true};
+    return {std::move(argument), true};
 }
 
-std::vector<syntax::arg> syntax::parse_arguments() {
-    std::vector<syntax::arg> args;
+void syntax::parse_arguments(std::pmr::vector<syntax::arg> &args) {
+    //enough for any instruction, only data lists (.word, .byte, ...) grow past it
+    args.reserve(max_inst_arguments);
     using token_type = lexer::token::types;
 
     //---first argument---//
-    const auto tk = lex_m.last_token();
-    const auto [argument, success] = try_parse_arg(tk);
+    auto [argument, success] = try_parse_arg(lex_m.last_token(), &arena_m);
     if (success == false) throw std::runtime_error("expected argument");
-    args.push_back(argument);
+    args.push_back(std::move(argument));
 
     //---argument list---//
     while(true) {
-	const auto first_tk = lex_m.fetch_token();
-	if (first_tk.get_type() == token_type::newline)
+	const auto &separator_tk = lex_m.fetch_token();
+	if (separator_tk.get_type() == token_type::newline)
 	    break;
 
-	if (first_tk.get_type() != token_type::comma)
-	    throw std::runtime_error(std::string{"expected comma. Got: "} + first_tk.to_string());
+	if (separator_tk.get_type() != token_type::comma)
+	    throw std::runtime_error(std::string{"expected comma. Got: "} + separator_tk.to_string());
 	
-	const auto second_tk = lex_m.fetch_token();
-	const auto [argument, success] = try_parse_arg(second_tk);
+	auto [argument, success] = try_parse_arg(lex_m.fetch_token(), &arena_m);
 	if (success == false) throw std::runtime_error("expected another argument");
-	args.push_back(argument);
+	args.push_back(std::move(argument));
     }
-
-    return args;
 }
 
 void syntax::eat_whitelines(void) {
-    auto tk = lex_m.last_token();
-    while(tk.get_type() == lexer::token::types::newline)
-        tk = lex_m.fetch_token();
+    while(lex_m.last_token().get_type() == lexer::token::types::newline)
+        lex_m.fetch_token();
 }
 
 std::pair<syntax::statement, bool> syntax::parse_statement() {
@@ -105,46 +126,52 @@ std::pair<syntax::statement, bool> syntax::parse_statement() {
 
     //---whitelines---//
     eat_whitelines();
-    auto tk = lex_m.last_token();
+    //tk always refers to the current token of the lexer
+    const lexer::token &tk = lex_m.last_token();
 
     //check if the lexer has reached the end of the file before attempting to parse another statement
     const bool eof = (tk.get_type() == token_type::eof);
     if (eof) return {syntax::statement {}, eof};
 
-    struct statement stmnt;
+    //the type and its mnemonic or directive are set once the statement is identified
+    struct statement stmnt {.type = statement_type::inst,
+                            .mnemonic = {},
+                            .directive = {},
+                            .args = std::pmr::vector<arg>(&arena_m)};
 
     //---label---//
     if (tk.get_type() == token_type::label) {
-        stmnt.label = tk.get_text();
-        tk = lex_m.fetch_token();
+        stmnt.label = tk.get_label();
+        lex_m.fetch_token();
         if (tk.get_type() != token_type::collon)
 	    throw std::runtime_error(std::string{"missing collon. Got: "} + tk.to_string());
 
-	tk = lex_m.fetch_token();
+	lex_m.fetch_token();
     }
 
     //---whitelines---//
     eat_whitelines();
-    tk = lex_m.last_token();
 
     //---directive/statement--//
     if (tk.get_type() == token_type::directive) {
 	stmnt.type = statement_type::dir;
-	stmnt.directive = tk.get_text();
+	if (tk.get_directive() == nullptr)
+	    throw std::runtime_error(std::string{"unknown directive: "} + std::string{tk.get_text()});
+	stmnt.directive = *tk.get_directive();
     } else if (tk.get_type() == token_type::mnemonic) {
         stmnt.type = statement_type::inst;
-	stmnt.mnemonic = tk.get_text();
+	stmnt.mnemonic = tk.get_mnemonic();
     } else throw std::runtime_error(std::string{"expected label, mnemonic or directive. Got: "} + tk.to_string());
 
     //---arguments---//
-    tk = lex_m.fetch_token();
+    lex_m.fetch_token();
     if(tk.get_type() != token_type::newline)
-	stmnt.args = parse_arguments();
+	parse_arguments(stmnt.args);
 
-    return {stmnt, eof};
+    return {std::move(stmnt), eof};
 }
 
 void syntax::parse_file(std::vector<statement> &tree) {
     for (auto ret = parse_statement(); ret.second != true; ret = parse_statement())
-        tree.push_back(ret.first);
+        tree.push_back(std::move(ret.first));
 }
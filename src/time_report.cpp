@@ -0,0 +1,64 @@
+#include "time_report.h"
+
+#include <iomanip>
+#include <sys/resource.h>
+#include <utility>
+#include <vector>
+
+namespace {
+bool enabled = false;
+std::vector<std::pair<std::string, std::chrono::steady_clock::duration>> phases;
+std::vector<std::pair<std::string, int64_t>> counters;
+}// namespace
+
+void time_report::enable() { enabled = true; }
+
+bool time_report::is_enabled() { return enabled; }
+
+void time_report::set_counter(const std::string &name, int64_t value) {
+    if (enabled == false) return;
+
+    for (auto &counter: counters) {
+        if (counter.first == name) {
+            counter.second = value;
+            return;
+        }
+    }
+
+    counters.emplace_back(name, value);
+}
+
+time_report::phase::phase(std::string name)
+    : name_m(std::move(name)), start_m(std::chrono::steady_clock::now()) {}
+
+time_report::phase::~phase() {
+    if (enabled == false) return;
+
+    phases.emplace_back(std::move(name_m), std::chrono::steady_clock::now() - start_m);
+}
+
+void time_report::print(std::ostream &strm) {
+    if (enabled == false) return;
+
+    using milliseconds = std::chrono::duration<double, std::milli>;
+
+    strm << "---time report---\n";
+    milliseconds total{0};
+    for (auto &[name, duration]: phases) {
+        const auto ms = std::chrono::duration_cast<milliseconds>(duration);
+        total += ms;
+        strm << std::left << std::setw(32) << name << std::right << std::fixed
+             << std::setprecision(3) << std::setw(12) << ms.count() << " ms\n";
+    }
+    strm << std::left << std::setw(32) << "total" << std::right << std::setw(12) << total.count()
+         << " ms\n";
+
+    for (auto &[name, value]: counters)
+        strm << std::left << std::setw(32) << name << std::right << std::setw(12) << value << "\n";
+
+    //---peak resident set size---//
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        strm << std::left << std::setw(32) << "peak rss" << std::right << std::setw(12)
+             << usage.ru_maxrss << " KiB\n";
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "lexer.h"
+#include "syntax.h"
+
+//---counting allocator---//
+static std::atomic<std::size_t> allocations = 0;
+
+void *operator new(std::size_t size) {
+    allocations++;
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc();
+}
+
+//memory resources allocate with an alignment
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    allocations++;
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    if (void *ptr = std::aligned_alloc(align, (size + align - 1) / align * align)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+//every token type, the same few labels over and over so interning only allocates once
+static std::string repeated_source(int nrepeats) {
+    std::string source = ".data\nmsg: .byte 'h', 'i'\n.text\n";
+    for (int i = 0; i < nrepeats; i++)
+        source += "loop: addi s0, s0, -1\n"
+                  "    bne s0, zero, loop\n"
+                  "    set t1, 0x1234\n"
+                  "    lw t0, 'a'\n"
+                  ".word 1, 0b101, -3\n";
+
+    return source;
+}
+
+TEST(allocation, lexing_does_not_allocate_per_token) {
+    const auto source = repeated_source(10000);
+    lexer lex(source, lexer_backend::simd);
+
+    //the first pass over the labels interns them
+    lex.fetch_token();
+    const std::size_t before = allocations;
+
+    std::size_t ntokens = 0;
+    while (lex.fetch_token().get_type() != lexer::token::types::eof) ntokens++;
+
+    EXPECT_GT(ntokens, 250000u);
+    EXPECT_LE(allocations - before, 16u);
+}
+
+TEST(allocation, parsing_allocates_per_arena_block) {
+    const auto source = repeated_source(10000);
+    std::vector<syntax::statement> tree;
+    tree.reserve(60000);
+
+    const std::size_t before = allocations;
+    std::size_t nstatements = 0;
+    {
+        syntax parser(source, lexer_backend::simd);
+        parser.parse_file(tree);
+        nstatements = tree.size();
+
+        //statements point into the parser's arena and are released before it
+        tree.clear();
+    }
+
+    //argument lists come out of 64 KiB arena blocks, not one allocation each
+    EXPECT_EQ(nstatements, 50003u);
+    EXPECT_LT(allocations - before, nstatements / 100);
+}
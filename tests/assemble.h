@@ -0,0 +1,58 @@
+#ifndef ASSEMBLER_TESTS_ASSEMBLE_H
+#define ASSEMBLER_TESTS_ASSEMBLE_H
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "binary_generator.h"
+#include "elfio/elfio.hpp"
+#include "isa.h"
+#include "program_options.h"
+#include "semantic_analyzer.h"
+#include "syntax.h"
+
+//output file named after the running test, in the temp directory
+inline std::filesystem::path test_output_path(std::string_view suffix = "") {
+    const auto *test = ::testing::UnitTest::GetInstance()->current_test_info();
+    return std::filesystem::temp_directory_path() /
+           (std::string{"assembler_"} + test->test_suite_name() + "_" + test->name() +
+            std::string{suffix} + ".elf");
+}
+
+//assembles the source the way main does without preprocessing, options are command line flags
+inline void assemble(std::string_view source, const std::filesystem::path &output,
+                     std::vector<std::string> options = {}) {
+    std::vector<std::string> arguments = {"assembler", "test.s", "-o", output.string()};
+    arguments.insert(arguments.end(), options.begin(), options.end());
+
+    std::vector<char *> argv;
+    for (auto &argument: arguments) argv.push_back(argument.data());
+
+    program_options program_options(argv.size(), argv.data());
+    syntax parser(source, program_options.lexer);
+    auto compile_unit = semantic_analyzer(parser, program_options);
+    binary_generator(output.string(), compile_unit);
+}
+
+//decodes the .text section of an assembled file
+inline std::vector<isa::located_instruction> text_instructions(const std::filesystem::path &path) {
+    ELFIO::elfio elf;
+    if (elf.load(path.string()) == false)
+        throw std::runtime_error("could not load " + path.string());
+
+    std::vector<isa::located_instruction> instructions;
+    if (const auto *text = elf.sections[".text"]) {
+        const auto *bytes = reinterpret_cast<const uint8_t *>(text->get_data());
+        isa::decode_many(std::span(bytes, bytes == nullptr ? 0 : text->get_size()), instructions);
+    }
+
+    return instructions;
+}
+
+#endif//ASSEMBLER_TESTS_ASSEMBLE_H
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "binary_data.h"
+
+using binary_data::allignment_t;
+using binary_data::memory_alloc_t;
+
+static std::vector<memory_alloc_t> random_allocs(std::mt19937 &random, std::size_t nallocs) {
+    std::vector<memory_alloc_t> allocs(nallocs);
+    for (auto &alloc: allocs) {
+        alloc.allignment = (allignment_t) (random() % 3);
+        alloc.nbytes = random() % 9;
+    }
+    return allocs;
+}
+
+//the addresses and end a plain alligned_counter walk gives
+static uint32_t serial_layout(const std::vector<memory_alloc_t> &allocs,
+                              std::vector<uint32_t> &addresses, uint32_t start) {
+    binary_data::alligned_counter counter(start);
+    for (std::size_t i = 0; i < allocs.size(); i++) addresses[i] = counter.increment(allocs[i]);
+    return counter.get_count();
+}
+
+//blocks are summarized and placed on their own, the result has to match the serial walk from
+//every start phase
+TEST(binary_data, parallel_layout_matches_serial_walk) {
+    std::mt19937 random(18);
+
+    for (int run = 0; run < 40; run++) {
+        const auto allocs = random_allocs(random, random() % 100000);
+
+        for (const uint32_t start: {0u, 1u, 2u, 3u, 1001u}) {
+            std::vector<uint32_t> expected(allocs.size());
+            std::vector<uint32_t> addresses(allocs.size());
+
+            const uint32_t expected_end = serial_layout(allocs, expected, start);
+            EXPECT_EQ(binary_data::layout(allocs, addresses, start, 4), expected_end)
+                    << allocs.size() << " allocs from " << start;
+            ASSERT_EQ(addresses, expected) << allocs.size() << " allocs from " << start;
+        }
+    }
+}
+
+//a run of byte allocations never meets in one phase, summarize has to follow all four to the end
+TEST(binary_data, summary_of_unaligned_run) {
+    const std::vector<memory_alloc_t> allocs(100, {.nbytes = 3, .allignment = allignment_t::byte});
+    const auto summary = binary_data::summarize(allocs);
+
+    for (uint32_t start = 0; start < 8; start++) EXPECT_EQ(summary.end(start), start + 300);
+}
@@ -0,0 +1,3427 @@
+.data
+d0: .halfword 7303
+d1: .word -1051970500, 63
+d2: .word_array 31
+d3: .byte_array 7
+d4: .halfword -23849
+d5: .word_array 2
+d6: .word_array 28
+d7: .word 0, 0
+d8: .word 841095768, 34
+d9: .byte_array 4
+d10: .word 0, 0
+d11: .word 1724117817, 3
+d12: .word 177865246, 48
+d13: .byte_array 4
+d14: .word_array 2
+d15: .word 0, 0
+d16: .halfword 20049
+d17: .word_array 32
+d18: .word 0, 0
+d19: .halfword -7345
+d20: .halfword 14357
+d21: .halfword 19869
+d22: .word_array 19
+d23: .word -1717985729, 80
+d24: .byte_array 5
+d25: .word 1044306954, 92
+d26: .byte_array 9
+d27: .word_array 33
+d28: .byte_array 4
+d29: .byte 145, 1, 2
+d30: .word 0, 0
+d31: .word_array 33
+d32: .word_array 38
+d33: .word -84924484, 95
+d34: .word_array 27
+d35: .byte_array 3
+d36: .byte 191, 1, 2
+d37: .word 36191509, 99
+d38: .halfword 4140
+d39: .word_array 24
+d40: .word_array 2
+d41: .word_array 3
+d42: .byte 201, 1, 2
+d43: .byte_array 3
+d44: .halfword 2914
+d45: .halfword -29194
+d46: .halfword 5364
+d47: .word 0, 0
+d48: .halfword -3494
+d49: .word 0, 0
+d50: .byte 180, 1, 2
+d51: .word_array 18
+d52: .byte_array 9
+d53: .word 0, 0
+d54: .byte_array 1
+d55: .word_array 33
+d56: .halfword 3992
+d57: .word 0, 0
+d58: .halfword -2076
+d59: .word 233651350, 64
+d60: .word_array 32
+d61: .byte 212, 1, 2
+d62: .byte 0, 1, 2
+d63: .word 0, 0
+d64: .word 0, 0
+d65: .word 0, 0
+d66: .word 0, 0
+d67: .byte 234, 1, 2
+d68: .word 0, 0
+d69: .word 1308115972, 81
+d70: .halfword 6094
+d71: .word 0, 0
+d72: .halfword 26427
+d73: .word -1051004095, 86
+d74: .word -2075797930, 1
+d75: .byte 127, 1, 2
+d76: .byte 56, 1, 2
+d77: .word 0, 0
+d78: .halfword -7428
+d79: .byte 35, 1, 2
+d80: .halfword -19539
+d81: .byte 86, 1, 2
+d82: .byte_array 5
+d83: .byte_array 5
+d84: .word_array 21
+d85: .word_array 31
+d86: .word -2045973917, 49
+d87: .byte 215, 1, 2
+d88: .halfword -13065
+d89: .word 2047575320, 77
+d90: .word_array 2
+d91: .halfword -28830
+d92: .word_array 10
+d93: .word -1459311380, 90
+d94: .word 0, 0
+d95: .byte_array 7
+d96: .word 0, 0
+d97: .halfword 11338
+d98: .byte_array 9
+d99: .word_array 15
+d100: .word 0, 0
+d101: .byte_array 1
+d102: .word_array 37
+d103: .byte 218, 1, 2
+d104: .word 1019845352, 16
+d105: .halfword 27379
+d106: .word -831563116, 9
+d107: .byte 152, 1, 2
+d108: .byte_array 3
+d109: .word_array 37
+d110: .byte 66, 1, 2
+d111: .word 1505500567, 75
+d112: .halfword 29035
+d113: .word 0, 0
+d114: .word_array 11
+d115: .byte_array 9
+d116: .word -524119856, 44
+d117: .word -1313750402, 13
+d118: .byte_array 7
+d119: .byte 255, 1, 2
+d120: .word 1596102224, 36
+d121: .word -1473322820, 41
+d122: .word 0, 0
+d123: .halfword -7778
+d124: .word_array 14
+d125: .byte 49, 1, 2
+d126: .word_array 36
+d127: .byte 248, 1, 2
+d128: .word 0, 0
+d129: .halfword -25720
+d130: .byte_array 1
+d131: .word -1576179925, 21
+d132: .word 0, 0
+d133: .halfword -12436
+d134: .byte 130, 1, 2
+d135: .byte 173, 1, 2
+d136: .byte 58, 1, 2
+d137: .byte 120, 1, 2
+d138: .word 0, 0
+d139: .byte_array 8
+d140: .halfword 8008
+d141: .word 0, 0
+d142: .word -769976151, 52
+d143: .word -1610538640, 14
+d144: .word 0, 0
+d145: .word 0, 0
+d146: .word_array 5
+d147: .word 0, 0
+d148: .word 0, 0
+d149: .halfword 7091
+.bss
+z0: .word_array 11
+z1: .word_array 35
+z2: .word_array 47
+z3: .word_array 38
+z4: .word_array 15
+z5: .word_array 59
+z6: .word_array 36
+z7: .word_array 14
+z8: .word_array 6
+z9: .word_array 38
+z10: .word_array 2
+z11: .word_array 2
+z12: .word_array 12
+z13: .word_array 53
+z14: .word_array 15
+z15: .word_array 6
+z16: .word_array 25
+z17: .word_array 31
+z18: .word_array 54
+z19: .word_array 21
+z20: .word_array 15
+z21: .word_array 58
+z22: .word_array 22
+z23: .word_array 31
+z24: .word_array 21
+z25: .word_array 14
+z26: .word_array 56
+z27: .word_array 49
+z28: .word_array 38
+z29: .word_array 33
+.text
+.global start
+.global ext_fn
+.global fn0_
+start: addi sp, zero, 100
+fn0_: add t0, t0, t1
+bgeu t2, ra, fn0_
+xor t2, k0, fn0
+lb k0, d28
+not t3, t0
+multi sp, t0, 7
+xnor t2, s3
+f_next: sw t2, d148
+neg s3, s3
+grt sp, sp, zero
+b_loop: jal fn96_
+b_loop: jmp b_loop
+jal ra, t0
+divu s0, s0
+jal t1
+set s0, 5
+multui s2, s1, 8000
+neg t0, sp
+jal fn70_
+not zero, fn0
+jal ext_fn
+b_loop: jmp b_loop
+b_loop: set t3, d148
+divi fn0, s1, 100
+b_loop: set ar, d1
+lsfti s3, t2, 14
+f_next: jmp ra
+fn1_: add t0, t0, t1
+sw t2, t0, 65
+b_loop: addi t3, -6
+set t1, -5
+bne k0, sp, fn0_
+set s1, d39
+neg ar, fn0
+bne ra, sp, fn1_
+jal fn10_
+ori s3, fn0, 100
+b_loop: jmp b_loop
+lhu s2, d30
+sw t1, d71
+addi k0, -15
+grt s2, s1, t1
+rsftia k0, s1, 16
+set gp, 123456789
+lsfti gp, 0
+f_next: grtu s0, sp
+set fn1, -70000
+jal fn0_
+grtu fn0, t2
+b_loop: jmp b_loop
+eql zero, t0
+jal fn106_
+bgru fn1, t1, fn0_
+f_next: jmp ra
+fn2_: add t0, t0, t1
+sw zero, fn0, 48
+sb sp, d126
+bgr zero, fn1, fn1_
+jal fn34_
+jal t1
+rsft t1, s0, k0
+jal t1
+and fn1, sp, t3
+f_next: nand s1, sp
+sh s2, d135
+addi sp, 7
+lw t1, t0, -9
+set fn0, d44
+sw s3, t0, 56
+bge fn0, t2, fn3_
+b_loop: jmp b_loop
+and k0, s0
+set s1, d35
+b_loop: jmp b_loop
+lw s2, d78
+nor gp, s1
+b_loop: xor zero, s2, ra
+sw t2, t0, -70
+set fn0, d59
+lw s3, t1, 18
+f_next: jmp ra
+fn3_: add t0, t0, t1
+set t0, -5
+lw ra, zero, -99
+jal t1
+neg zero, zero
+sw fn0, d65
+b_loop: divi ra, ra, 1
+f_next: set t0, 123456789
+nor s0, t0
+jal fn57_
+sh s3, d62
+divu t3, fn1, ra
+lbu fn1, d17
+beq t0, s1, fn1_
+b_loop: multi fn1, ra, -8000
+nand ar, t3, gp
+b_loop: lbu ra, d113
+jal fn90_
+b_loop: sw sp, t0, -17
+sub t0, t2
+beq t1, gp, fn4_
+jal ra, t0
+lbu ar, d26
+rsfti t1, s1, 1
+addi fn1, 6
+f_next: rsfti fn1, t1, 20
+f_next: jmp ra
+fn4_: add t0, t0, t1
+lbu zero, d134
+gre t2, sp
+sw fn0, sp, 48
+b_loop: jmp f_next
+grt s3, t2, t3
+b_loop: jmp b_loop
+lw zero, s0, -36
+jal fn14_
+rsftia gp, t0, 3
+bgeu sp, sp, fn3_
+jal fn55_
+nor t1, s3, s2
+set s3, d108
+lw ar, sp, -35
+sh ar, d19
+sb fn1, d10
+lh t1, d1
+set t2, 123456789
+set t1, -70000
+sb fn1, d148
+not s0, s1
+neg t3, fn1
+sb zero, d23
+rsfta t0, t3
+jal fn43_
+f_next: jmp ra
+fn5_: add t0, t0, t1
+sh s0, d106
+b_loop: addi t0, t3, -8000
+jal ra, t0
+not t0, fn1
+lhu fn0, d108
+b_loop: eql s0, s3
+b_loop: bgr s0, ar, fn3_
+sw sp, d109
+set s2, d136
+sw fn1, d30
+neg s2, sp
+jal ra, t0
+jal fn14_
+set fn0, d51
+rsfti ar, s2, 18
+b_loop: jmp b_loop
+sw t0, ra, 38
+jal fn107_
+neql fn1, s0
+rsftia s0, fn1, 3
+not ar, s2
+sw s1, s1, 89
+set ra, d129
+lh t2, d126
+lw t0, s3, -78
+f_next: jmp ra
+fn6_: add t0, t0, t1
+jal fn72_
+multi t1, fn1, -300
+b_loop: lw t1, d56
+xnor t2, t0
+set gp, d84
+lh ra, d88
+b_loop: div t1, t2
+f_next: addi sp, -8
+sb s3, d24
+f_next: jal fn113_
+lh t0, d103
+nand ar, fn1
+set s3, 2147483647
+neg s1, s3
+addi t0, 1
+set gp, 2147483647
+b_loop: lbu t3, d139
+set zero, -70000
+neg s0, s2
+sw t3, t1, -60
+lsfti gp, s0, 25
+neg zero, s0
+sw k0, d7
+b_loop: jmp b_loop
+not ra, gp
+f_next: jmp ra
+fn7_: add t0, t0, t1
+lw ra, gp, 50
+rsfti t3, ar, 17
+jal t1
+addi gp, -14
+bgr t0, ra, fn9_
+sh k0, d60
+jal fn43_
+jal fn69_
+jal fn96_
+bgru s2, fn0, fn6_
+sh t2, d62
+b_loop: jmp b_loop
+lh fn1, d112
+sh s0, d38
+add sp, s1, k0
+b_loop: jmp b_loop
+jal t1
+jal ra, t0
+sw fn0, d1
+set s1, 2147483647
+rsfti s1, fn0, 10
+b_loop: set s2, d109
+addi s2, -12
+addi ra, 8
+nor ra, s3
+f_next: jmp ra
+fn8_: add t0, t0, t1
+b_loop: jmp f_next
+jal ra, t0
+multui k0, fn1, 8000
+set fn0, 123456789
+addi t0, 1
+jal ext_fn
+bgr t0, t0, fn8_
+sw s0, d64
+addi s2, 11
+bge k0, fn0, fn7_
+sub zero, fn0
+sb s0, d137
+b_loop: set s3, 123456789
+sb fn0, d91
+bgeu s0, t3, fn9_
+set t1, 5
+bge gp, t3, fn9_
+not s1, s0
+jal fn55_
+jal fn64_
+set s2, 123456789
+sb t0, d0
+bge fn0, ar, fn10_
+f_next: set s1, d141
+set t0, 123456789
+f_next: jmp ra
+fn9_: add t0, t0, t1
+jal fn12_
+jal fn71_
+f_next: eql fn0, t2, s3
+b_loop: sub fn1, k0
+addi fn0, 7
+addi sp, 5
+divu s0, t1, ar
+and fn0, sp, fn0
+b_loop: jmp b_loop
+not ra, ar
+gre s0, t0, sp
+jal ra, t0
+sw gp, d9
+set t2, d86
+f_next: lb sp, d124
+b_loop: jal fn69_
+lw s1, t2, -8
+addi gp, 9
+lb t2, d66
+set s3, d67
+b_loop: jmp b_loop
+set s1, d68
+b_loop: sh t0, d60
+b_loop: addi ar, -13
+bne sp, t2, fn9_
+f_next: jmp ra
+fn10_: add t0, t0, t1
+not t3, ra
+divu ra, fn1, s1
+addi gp, 1
+sw t2, t3, -44
+b_loop: jal fn62_
+sub zero, s3, sp
+f_next: set s2, 5
+sw t2, fn0, 67
+xor t1, fn1
+f_next: set zero, d26
+jal fn108_
+sh sp, d107
+addi ar, 12
+set t1, d144
+b_loop: jmp b_loop
+f_next: neg k0, k0
+lhu t2, d37
+sw t3, d2
+not fn0, zero
+lw s2, d20
+lw s0, d75
+sb s1, d129
+bgr fn0, fn1, fn12_
+lw fn1, s3, 55
+neql fn0, fn0, s2
+f_next: jmp ra
+fn11_: add t0, t0, t1
+set t3, d0
+bgru s1, s0, fn9_
+lbu ar, d81
+set t0, d109
+xnor ar, gp, s3
+jal ra, t0
+sw s1, d33
+neg s2, zero
+b_loop: jal fn93_
+beq ra, t2, fn11_
+b_loop: jmp f_next
+grt t1, t0, s3
+multi k0, ra, -300
+lbu s1, d129
+b_loop: jal fn23_
+addi ra, 4
+bne s3, ra, fn11_
+b_loop: lw k0, d51
+b_loop: jmp b_loop
+div sp, s3, t1
+bne ra, t0, fn10_
+lbu fn0, d98
+nor t2, s1
+set fn1, d70
+set t2, 123456789
+f_next: jmp ra
+fn12_: add t0, t0, t1
+jal ra, t0
+lw t3, d32
+neg s1, k0
+jal fn10_
+jal t1
+lb sp, d109
+ori t2, sp, 1
+jal fn5_
+bgeu t3, t3, fn14_
+jal fn83_
+grt s2, ra
+addi fn0, -1
+lb zero, d50
+nand t0, s0
+rsfti k0, ar, 27
+divui t0, s2, 0
+addi zero, -6
+f_next: sw sp, s3, 73
+bgeu s2, t2, fn11_
+set zero, d55
+lw t3, d127
+set t2, 2147483647
+bgr t2, sp, fn13_
+lw t2, d4
+divi t0, t1, -8000
+f_next: jmp ra
+fn13_: add t0, t0, t1
+f_next: lw t1, ra, -71
+sh t3, d144
+lw t2, s0, -10
+and s2, fn0
+lw ra, s3, -80
+b_loop: bge ar, ar, fn13_
+set ar, 1000
+rsfta s1, t3, ra
+jal ra, t0
+lsfti sp, 14
+b_loop: jmp b_loop
+multui t2, s1, 8000
+f_next: set s3, d15
+sw k0, gp, -20
+neg s1, t1
+lsfti t1, 5
+set s2, -5
+f_next: jal fn43_
+nand s1, k0
+lw ra, sp, 84
+b_loop: lsft s0, k0
+sb ra, d49
+set t3, d44
+jal ext_fn
+b_loop: set sp, -70000
+f_next: jmp ra
+fn14_: add t0, t0, t1
+lsfti gp, 12
+rsft k0, t2, gp
+rsftia s0, t2, 30
+multi s2, k0, -1
+jal fn13_
+b_loop: sw t3, d143
+lhu ar, d114
+not t2, t1
+addi gp, gp, 100
+set ar, 2147483647
+set t2, -70000
+set fn0, d137
+addi s3, -13
+b_loop: jmp b_loop
+greu t3, t3, fn1
+lsfti s3, 10
+sw zero, d99
+jal fn77_
+b_loop: jmp b_loop
+lsfti fn0, 6
+beq t3, sp, fn15_
+addi t2, s0, -8000
+sb t0, d53
+addi s0, -9
+lw t2, t2, 52
+f_next: jmp ra
+fn15_: add t0, t0, t1
+b_loop: addi s3, ar, -1
+set sp, d34
+set s2, -5
+bgr sp, fn0, fn16_
+neql s2, zero, t1
+mult gp, gp, fn0
+lbu ar, d71
+divui fn1, t3, 100
+set s0, 5
+b_loop: addi fn0, 13
+b_loop: jmp b_loop
+nand zero, ra, fn1
+jal ext_fn
+bgru t2, ra, fn17_
+sw ra, t3, -70
+jal ext_fn
+sh s0, d38
+b_loop: neg ar, sp
+b_loop: jmp b_loop
+b_loop: sb gp, d32
+set fn0, 2147483647
+set fn0, d122
+jal ext_fn
+lsfti gp, 3
+lw sp, d0
+f_next: jmp ra
+fn16_: add t0, t0, t1
+set sp, -5
+sw fn0, ra, 71
+b_loop: set ar, d112
+lsfti ar, 14
+b_loop: set s1, 2147483647
+bge s1, t2, fn18_
+jal fn88_
+sh ar, d56
+b_loop: neg ar, gp
+jal ra, t0
+b_loop: jmp b_loop
+lsfti k0, ar, 2
+bgr s0, zero, fn18_
+addi k0, 2
+nand zero, fn0, gp
+xnor k0, sp
+set ra, d48
+b_loop: ori gp, t1, 0
+b_loop: jmp b_loop
+rsfti fn1, t0, 22
+set s3, d17
+jal ext_fn
+sh fn1, d111
+jal t1
+rsft fn1, t3, t3
+f_next: jmp ra
+fn17_: add t0, t0, t1
+set s3, 5
+b_loop: jmp b_loop
+jal ext_fn
+not gp, ar
+jal fn78_
+grtu s2, s0, fn0
+b_loop: jal fn98_
+sw s3, d126
+b_loop: jal fn37_
+bgr gp, s3, fn16_
+sw fn1, fn0, 41
+f_next: sh s0, d108
+b_loop: divui fn1, gp, 8000
+lsfti t0, 3
+lbu t0, d6
+set t3, 1000
+neg fn1, fn0
+or fn0, ar, s3
+b_loop: set ra, 1000
+b_loop: set ra, d116
+f_next: sub sp, sp
+b_loop: jal ra, t0
+lbu t3, d83
+jal ra, t0
+set s3, 2147483647
+f_next: jmp ra
+fn18_: add t0, t0, t1
+b_loop: jmp b_loop
+not zero, ar
+neg s3, s1
+divu sp, t2
+sw k0, d55
+sh s3, d74
+set t2, 0
+b_loop: neql gp, k0
+bge s1, k0, fn19_
+f_next: set t1, 5
+set t0, -5
+f_next: neg k0, ra
+b_loop: lsfti t1, 3
+addi s2, -8
+set zero, d112
+b_loop: bne ar, s1, fn20_
+multu t2, sp, t0
+lsfti t0, 12
+jal ra, t0
+b_loop: not fn0, s0
+f_next: set ra, d81
+divui ar, sp, 8000
+b_loop: jmp b_loop
+sb ra, d55
+lsfti zero, 8
+f_next: jmp ra
+fn19_: add t0, t0, t1
+addi s3, -11
+lsfti t1, 0
+xori fn1, ar, 8000
+lsfti fn0, s3, 6
+nor t3, fn1
+jal ra, t0
+neg fn0, gp
+multui zero, fn1, 0
+set k0, d28
+jal fn29_
+sw ra, t0, 50
+set s0, -70000
+lsfti ar, fn0, 15
+grtu t0, zero, sp
+lh t1, d20
+lsfti gp, ar, 30
+b_loop: set ra, d15
+divu ar, t2, zero
+lw t3, ra, -95
+lw s3, sp, 1
+f_next: or s1, ra, fn1
+addi k0, -4
+b_loop: jal t1
+sh k0, d86
+set fn1, d41
+f_next: jmp ra
+fn20_: add t0, t0, t1
+sb s1, d68
+sh k0, d101
+set s3, -5
+lsft s1, t0, t0
+b_loop: sw gp, s3, -62
+div k0, k0
+b_loop: jmp f_next
+b_loop: not s2, t3
+set t2, d97
+jal fn104_
+bgru fn1, fn1, fn22_
+not t3, fn0
+gre s1, s0
+b_loop: jmp b_loop
+neql t3, s1
+b_loop: jmp b_loop
+bgru t3, ra, fn22_
+b_loop: neql s0, s2
+sh t2, d123
+b_loop: lbu ra, d35
+jal ext_fn
+b_loop: add s1, t0
+addi t0, 0
+set fn0, 1000
+b_loop: addi t2, -8
+f_next: jmp ra
+fn21_: add t0, t0, t1
+jal fn48_
+b_loop: jal fn44_
+b_loop: jmp b_loop
+and zero, t2, fn0
+bge k0, gp, fn22_
+sw zero, d142
+set s1, d103
+b_loop: bgr fn1, s1, fn23_
+sw ra, fn0, 38
+set s1, d116
+sb s0, d128
+b_loop: jal fn75_
+set ra, d74
+divui gp, t0, 7
+div k0, s0, k0
+f_next: addi gp, -10
+b_loop: bgeu gp, ra, fn21_
+sw fn0, d57
+addi fn0, s1, 7
+lw zero, d147
+b_loop: neg zero, ra
+bge t0, k0, fn22_
+grtu s0, zero
+lhu s0, d70
+eql t2, s0
+f_next: jmp ra
+fn22_: add t0, t0, t1
+set s3, 2147483647
+jal ra, t0
+jal fn56_
+nand t2, s2
+lsfti t3, 8
+b_loop: jal ra, t0
+b_loop: jmp b_loop
+b_loop: sw gp, s3, -73
+sh s2, d41
+lsfti t3, 8
+f_next: set t0, d123
+f_next: jmp f_next
+divu s2, t0, s3
+greu s2, gp
+gre fn1, t2, t0
+sh sp, d111
+lsfti zero, 3
+set s3, d137
+lw sp, fn0, -61
+bgru fn0, ar, fn20_
+sw ar, d55
+jal fn4_
+jal ra, t0
+jal ext_fn
+sh ra, d79
+f_next: jmp ra
+fn23_: add t0, t0, t1
+set ar, -5
+not s0, t0
+sb ar, d43
+b_loop: sb s2, d81
+rsft gp, t2, s0
+nand fn1, s3, sp
+add s1, t0, s2
+jal ext_fn
+b_loop: lsft gp, fn0, t1
+f_next: sw t2, d107
+set sp, d86
+b_loop: jmp b_loop
+lsfti fn1, fn0, 4
+f_next: addi t0, -11
+divui gp, t1, 7
+b_loop: jmp f_next
+addi fn0, zero, 1
+f_next: set fn0, d87
+eql sp, s1
+b_loop: jmp b_loop
+sw fn0, d4
+b_loop: jal fn53_
+b_loop: jmp b_loop
+jal ra, t0
+jal fn11_
+f_next: jmp ra
+fn24_: add t0, t0, t1
+set t0, d49
+set s3, 2147483647
+neg t0, t3
+set s3, d48
+set t0, 5
+bgeu ra, s3, fn25_
+not ra, ra
+jal ra, t0
+not s2, t1
+neg t3, s0
+b_loop: sh sp, d126
+lsfti t2, 0
+jal ra, t0
+jal ra, t0
+set fn1, d100
+neg t2, t3
+set fn0, d13
+sw ar, d98
+ori t2, k0, 7
+b_loop: jmp b_loop
+jal fn23_
+multu gp, t0, zero
+eql ra, t1, s0
+b_loop: addi fn1, t0, -300
+b_loop: jmp b_loop
+f_next: jmp ra
+fn25_: add t0, t0, t1
+lsfti s2, 12
+set sp, 123456789
+lw s3, s2, 56
+set t0, d16
+b_loop: jmp b_loop
+lb s1, d145
+lw s0, gp, 11
+bgeu fn0, t2, fn27_
+b_loop: xori k0, s1, 7
+jal fn45_
+rsfti s2, s0, 18
+set sp, d58
+jal ra, t0
+lw t1, t1, 59
+lsfti t2, 13
+addi fn0, -6
+b_loop: jal ra, t0
+lw fn1, fn0, -40
+set ra, 123456789
+jal fn40_
+rsfta s1, k0, s0
+ori gp, sp, 8000
+bgr s2, ra, fn27_
+sw s1, d60
+addi t1, 14
+f_next: jmp ra
+fn26_: add t0, t0, t1
+jal t1
+b_loop: jmp b_loop
+addi zero, -14
+set s1, d116
+b_loop: set s0, 123456789
+b_loop: set s0, -5
+jal fn95_
+addi fn0, 7
+greu zero, gp, k0
+b_loop: jmp b_loop
+bgeu s3, t2, fn26_
+addi s1, 13
+f_next: lbu t0, d16
+beq s0, fn1, fn26_
+neg fn0, gp
+neg fn1, t0
+b_loop: multu ar, s0, t3
+neql s0, s0
+sh s2, d33
+ori ra, t0, 1
+neg sp, k0
+bgeu s0, fn0, fn27_
+b_loop: jmp b_loop
+not zero, t1
+addi zero, -11
+f_next: jmp ra
+fn27_: add t0, t0, t1
+f_next: set s3, d33
+bge fn0, s3, fn29_
+jal t1
+lsfti t3, 2
+neql s2, t2
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+lbu gp, d90
+jal ra, t0
+b_loop: set k0, d110
+b_loop: addi t0, 5
+sh sp, d48
+sh gp, d114
+b_loop: lb fn1, d35
+addi s1, 3
+xnor gp, s1, k0
+set fn1, d13
+rsfti fn0, sp, 18
+set s3, d109
+b_loop: sw s1, ra, 80
+addi fn1, 10
+f_next: rsfti s0, sp, 3
+b_loop: jmp f_next
+set s0, 0
+neg ra, k0
+f_next: jmp ra
+fn28_: add t0, t0, t1
+grtu fn0, t1, fn0
+lw gp, fn1, -82
+f_next: lsfti sp, 6
+lhu k0, d142
+set k0, d96
+grtu k0, s2
+bne fn0, fn0, fn29_
+lsfti t0, 15
+lw gp, s2, 76
+lw fn0, fn1, -5
+set s1, 0
+set k0, d79
+f_next: not fn1, t3
+sh s2, d118
+set fn1, d72
+not k0, t1
+set s3, -70000
+lh fn1, d7
+jal fn9_
+lsft s3, t1
+f_next: set s0, d30
+bgr fn1, ra, fn27_
+nor fn1, gp
+sub t1, k0, ra
+lb t0, d43
+f_next: jmp ra
+fn29_: add t0, t0, t1
+neg ra, s0
+lsfti t1, zero, 10
+f_next: jmp f_next
+f_next: jal fn69_
+jal t1
+set gp, 123456789
+set sp, d127
+jal ra, t0
+lw s0, ar, 20
+not k0, t1
+b_loop: jmp f_next
+sw sp, d116
+lw s2, d81
+ori t1, sp, 1
+sw fn0, t3, 33
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+jal ext_fn
+jal fn99_
+addi ar, fn0, 1
+sb fn1, d120
+neg fn0, ra
+neg s0, fn0
+sw s3, s0, -27
+set ar, d84
+f_next: jmp ra
+fn30_: add t0, t0, t1
+ori fn0, sp, 8000
+b_loop: add sp, sp
+jal ext_fn
+jal t1
+lh fn1, d20
+lb gp, d2
+b_loop: jal fn52_
+b_loop: jmp b_loop
+b_loop: addi s1, 13
+b_loop: set t1, 2147483647
+neg t1, s1
+b_loop: jmp b_loop
+neql t0, ar, ar
+addi s3, -6
+b_loop: jmp b_loop
+set s2, d145
+lw sp, d76
+addi s0, 3
+rsfti t1, gp, 7
+b_loop: jmp b_loop
+f_next: jal fn103_
+sh ar, d120
+lbu s2, d132
+bne fn1, s2, fn30_
+lw t3, sp, 78
+f_next: jmp ra
+fn31_: add t0, t0, t1
+rsft k0, k0, k0
+jal fn82_
+sw s0, gp, 94
+sw s3, d50
+bgr t1, t3, fn30_
+xor t0, t1, s1
+b_loop: jmp b_loop
+and fn0, ar, k0
+b_loop: jmp b_loop
+addi s1, -4
+sb t3, d21
+and t3, t1, t3
+bgr zero, gp, fn32_
+not t0, ra
+sw s3, s1, 30
+eql gp, s1, fn1
+sw sp, d66
+addi k0, 11
+multu fn1, ra, k0
+set ra, 1000
+rsft k0, gp
+jal fn52_
+grtu t0, t2, zero
+ori t1, fn1, 1
+set ar, -70000
+f_next: jmp ra
+fn32_: add t0, t0, t1
+multu k0, fn0
+set sp, d135
+b_loop: ori t3, ar, 1
+set s0, 1000
+b_loop: jmp f_next
+lb t0, d92
+lhu k0, d94
+lhu s0, d33
+bgeu t0, fn1, fn34_
+sw t3, ar, -67
+sw s0, s3, -15
+b_loop: jmp f_next
+set s1, 123456789
+sw zero, d122
+b_loop: lb ar, d100
+sw s0, t2, -63
+lsfti s0, 15
+jal fn117_
+set s0, 123456789
+xnor t0, ar, t1
+and t2, fn0, t1
+lsfti t2, 8
+f_next: grtu s2, gp
+set t0, d85
+or t0, t3
+f_next: jmp ra
+fn33_: add t0, t0, t1
+lsfti zero, k0, 20
+jal fn26_
+sw s3, s2, 57
+rsfta k0, ar, t3
+sw t3, d14
+lhu t2, d36
+b_loop: lsfti ar, 15
+sw t0, gp, 81
+set fn1, d23
+bgru gp, fn1, fn35_
+f_next: addi gp, -10
+and t3, fn1
+jal fn105_
+jal t1
+b_loop: jmp b_loop
+set ar, d99
+jal ext_fn
+f_next: neg ra, zero
+lhu zero, d110
+set fn0, 0
+nand ar, fn0, t2
+rsftia s0, s0, 8
+set s2, d7
+jal ra, t0
+b_loop: jmp b_loop
+f_next: jmp ra
+fn34_: add t0, t0, t1
+b_loop: set fn1, 5
+bge zero, t2, fn32_
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+not t0, gp
+beq t3, fn0, fn35_
+lhu ar, d96
+b_loop: set ra, 123456789
+lw zero, t3, -81
+bne s0, k0, fn32_
+multui s3, ra, 1
+not t1, s3
+eql s1, t1, sp
+not s1, k0
+sh t3, d59
+divu k0, s0, t1
+sh zero, d36
+addi ra, -14
+jal t1
+eql s1, zero
+sh ra, d114
+set s0, d139
+set k0, d125
+addi t1, -7
+neg zero, t3
+f_next: jmp ra
+fn35_: add t0, t0, t1
+set ra, 0
+f_next: grtu ar, ar, t2
+b_loop: set s1, d89
+bne t3, s2, fn36_
+sw s3, d59
+nand t3, sp
+neql t1, t1
+b_loop: jmp b_loop
+bne s2, sp, fn36_
+grtu t0, ar
+jal t1
+lhu s2, d85
+multi ra, fn0, -300
+neg s2, t3
+lw k0, s0, 16
+sw t0, s0, -28
+gre s2, gp
+jal ext_fn
+set fn0, 0
+sb fn0, d37
+bgeu s3, s2, fn36_
+sw zero, t0, -94
+sw t0, d25
+sw ar, d20
+b_loop: set t2, d98
+f_next: jmp ra
+fn36_: add t0, t0, t1
+set t2, d91
+bgr s3, fn1, fn35_
+b_loop: jmp b_loop
+f_next: set s2, d145
+ori fn1, ra, 1
+set t3, -5
+jal fn44_
+b_loop: jmp b_loop
+jal ra, t0
+rsft fn0, t0
+grt zero, t3
+sb k0, d84
+f_next: lw gp, s3, -31
+lhu t3, d94
+jal ext_fn
+sb fn1, d77
+set gp, -70000
+neg fn1, s2
+addi t1, 2
+set sp, d105
+addi t3, -11
+b_loop: neql k0, sp, s2
+nor sp, ra, s0
+sw t1, zero, 55
+neg t3, ra
+f_next: jmp ra
+fn37_: add t0, t0, t1
+addi zero, 8
+or sp, k0, t1
+lhu sp, d97
+b_loop: jmp b_loop
+div t1, s3, fn0
+and sp, s3, sp
+sb t1, d129
+b_loop: jmp f_next
+lw s2, t0, 38
+b_loop: jmp f_next
+jal fn18_
+lbu k0, d94
+bgeu sp, zero, fn36_
+set t3, 1000
+set zero, 123456789
+addi s2, -6
+b_loop: set s1, 0
+not t3, fn1
+f_next: lbu ar, d33
+divi s2, fn1, 7
+jal fn53_
+jal fn48_
+xnor s2, gp, ra
+not s1, s1
+addi sp, k0, 100
+f_next: jmp ra
+fn38_: add t0, t0, t1
+divi k0, s3, 7
+set s3, d55
+jal ra, t0
+lsfti t0, 7
+lhu s2, d117
+set ra, 5
+addi sp, 10
+sw s2, d15
+sh ar, d95
+jal fn86_
+b_loop: jmp b_loop
+lhu s3, d48
+rsft s3, ar
+f_next: jal fn50_
+lh ra, d73
+addi t1, 12
+sh t0, d58
+lw s2, gp, 68
+jal fn18_
+bgru t0, zero, fn39_
+lh fn0, d53
+sb k0, d54
+div fn0, s3
+lw zero, t3, -86
+set fn0, d51
+f_next: jmp ra
+fn39_: add t0, t0, t1
+jal ra, t0
+addi ar, 10
+f_next: grtu fn1, sp, s1
+b_loop: jal fn37_
+set s1, -5
+set t1, 123456789
+b_loop: jmp b_loop
+lsfti t2, 11
+f_next: jal fn50_
+grtu s1, ra
+bgr s2, s0, fn38_
+sw t0, d76
+set k0, 0
+lw fn1, fn0, -53
+not zero, s3
+jal fn56_
+b_loop: neg t2, s1
+b_loop: lsfti ra, ra, 15
+rsfta k0, fn1, s3
+sh s3, d6
+grtu ar, t0
+b_loop: jmp b_loop
+sw t2, ra, -24
+addi s3, -16
+lhu t3, d64
+f_next: jmp ra
+fn40_: add t0, t0, t1
+nand t1, t3, t2
+sw k0, d83
+addi fn1, fn0, -300
+mult k0, s1
+set s0, d16
+and s0, s3, ra
+set k0, -5
+set t3, d145
+xnor t3, t0, s3
+nand ra, t1
+lw sp, s2, -88
+set sp, d142
+set s0, d110
+jal fn90_
+addi s1, -16
+f_next: jmp f_next
+sw s1, d1
+jal ra, t0
+xor s0, fn0
+set ar, 2147483647
+or sp, fn1, fn0
+lsft ar, fn0, t3
+rsft s1, s0, t2
+lsfti zero, 11
+lhu s0, d9
+f_next: jmp ra
+fn41_: add t0, t0, t1
+jal ra, t0
+b_loop: lh s0, d61
+lh k0, d50
+sb s1, d117
+xnor gp, ra, s0
+sw ra, d18
+set fn1, d68
+bgeu sp, t2, fn39_
+jal ext_fn
+lsft fn0, s0
+jal ext_fn
+lw gp, fn0, 13
+lhu ar, d15
+addi ar, -12
+bgr t1, s0, fn43_
+b_loop: jal fn10_
+addi zero, zero, -1
+b_loop: or t3, ar, ra
+jal fn68_
+add t0, t3
+b_loop: lw s1, s1, 93
+b_loop: set fn0, d49
+set ar, d31
+lhu gp, d138
+jal fn12_
+f_next: jmp ra
+fn42_: add t0, t0, t1
+b_loop: neg t2, k0
+set t1, d129
+sw s0, t1, 49
+not ra, fn0
+bgeu t2, t0, fn40_
+set fn0, d138
+b_loop: set s0, d64
+gre sp, t0, fn0
+gre k0, fn1
+b_loop: jmp f_next
+f_next: set s2, d100
+set s0, d34
+jal ext_fn
+jal fn0_
+lh s2, d112
+set fn0, d84
+b_loop: jmp b_loop
+neg ar, s3
+or s1, gp
+bgeu fn0, s3, fn44_
+mult ar, t0
+set zero, d85
+set s3, d110
+lsfti fn1, sp, 16
+beq t0, fn0, fn40_
+f_next: jmp ra
+fn43_: add t0, t0, t1
+nor ar, s1
+b_loop: sh fn0, d98
+b_loop: lw s0, sp, 27
+sb k0, d50
+sh zero, d11
+lw s2, fn0, -28
+multu k0, s1
+b_loop: not t1, ra
+set ar, d22
+rsftia ar, t0, 24
+f_next: jal ext_fn
+f_next: neg t2, s1
+addi gp, -7
+not zero, fn0
+set s0, d140
+b_loop: jmp b_loop
+sb t2, d104
+b_loop: jmp b_loop
+jal fn104_
+divi t3, ar, -1
+sw s3, t0, -82
+bgeu s3, t0, fn42_
+jal fn45_
+divi ra, fn1, 5000
+lw s1, fn0, 70
+f_next: jmp ra
+fn44_: add t0, t0, t1
+jal fn40_
+not sp, fn1
+jal ra, t0
+mult t3, t1
+nand zero, fn0, gp
+rsfta gp, s2, t3
+rsfta gp, t0
+bgeu s0, gp, fn43_
+divu s3, t1
+jal ext_fn
+set s2, d3
+b_loop: jmp b_loop
+lsfti t3, 12
+eql t2, zero
+sw t0, d119
+addi s0, -1
+b_loop: jmp b_loop
+f_next: lbu s2, d115
+multu ar, s3, s3
+or s1, fn1, s3
+neg t1, s3
+or s1, s0
+sw s3, d7
+lw k0, d103
+sw gp, s2, 95
+f_next: jmp ra
+fn45_: add t0, t0, t1
+b_loop: jmp b_loop
+neg sp, fn0
+grt s2, ar, s0
+b_loop: sw fn0, ra, 63
+eql k0, ar, ar
+div t2, t1, fn1
+bgeu s1, t0, fn47_
+not gp, t3
+sh s3, d25
+lsfti gp, sp, 3
+sh s2, d125
+set fn0, d138
+set s3, 1000
+sw s1, d100
+greu s1, s1
+jal t1
+b_loop: jmp f_next
+neg t2, s2
+grtu ra, s2
+multi fn1, gp, 5000
+lb s1, d0
+b_loop: jmp b_loop
+set fn0, 0
+lb k0, d40
+sw gp, s1, -35
+f_next: jmp ra
+fn46_: add t0, t0, t1
+not s2, t3
+jal fn107_
+set gp, d110
+addi s3, -8
+jal fn8_
+b_loop: jmp b_loop
+lw ra, s3, -91
+bne s1, s2, fn45_
+b_loop: jmp b_loop
+set zero, 2147483647
+sb s3, d133
+lsfti s1, 1
+jal ra, t0
+rsfta ar, ar, t3
+bgeu t2, t0, fn48_
+b_loop: multu ar, s2, fn0
+jal ext_fn
+addi fn1, 13
+beq s2, ra, fn48_
+set fn0, d1
+divui s2, gp, 7
+jal fn76_
+greu ra, fn1
+set s1, d43
+b_loop: jmp b_loop
+f_next: jmp ra
+fn47_: add t0, t0, t1
+f_next: jal fn0_
+sh gp, d1
+sb k0, d47
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+jal t1
+or fn0, t3
+set t0, 0
+set t1, d117
+div gp, sp, fn1
+sh s1, d147
+sw t1, k0, 19
+addi s0, -13
+not s1, s2
+neg s1, sp
+jal fn108_
+lsfti s0, 7
+sw s3, d43
+jal fn79_
+b_loop: jal fn75_
+xor zero, k0, fn1
+jal fn109_
+addi t0, -9
+f_next: set ra, -5
+b_loop: greu gp, k0, t0
+f_next: jmp ra
+fn48_: add t0, t0, t1
+b_loop: bge t0, t2, fn48_
+lsfti t0, 2
+addi fn1, 13
+sb sp, d129
+sb s0, d9
+jal fn45_
+jal t1
+b_loop: jmp b_loop
+addi t0, 11
+lw zero, t0, 8
+bge t3, fn0, fn46_
+addi gp, -4
+b_loop: jal t1
+f_next: jal fn112_
+beq k0, s2, fn46_
+set gp, d9
+addi s2, 4
+sh t0, d149
+lhu s0, d92
+not ra, ra
+nand t3, s3
+not s1, s0
+set s0, 2147483647
+lsfti t3, 9
+sw zero, gp, -24
+f_next: jmp ra
+fn49_: add t0, t0, t1
+set gp, d61
+lb s0, d71
+jal ext_fn
+b_loop: jmp b_loop
+lw gp, d47
+sw ra, s0, -82
+b_loop: not s3, s3
+lsfti s0, 4
+xori zero, ar, 7
+b_loop: sw s0, fn0, 65
+f_next: neg s1, s3
+set t1, d47
+grt gp, sp, t2
+rsftia t3, zero, 28
+set s1, d3
+bge t1, s1, fn47_
+sw fn1, ar, 20
+lw gp, d58
+f_next: jmp f_next
+b_loop: jmp b_loop
+xor fn1, fn0, ra
+b_loop: jal fn97_
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+set t2, d45
+f_next: jmp ra
+fn50_: add t0, t0, t1
+lh fn1, d120
+f_next: jal t1
+addi sp, zero, 5000
+sub fn0, t0
+jal ext_fn
+lw zero, s1, 5
+jal fn22_
+jal fn88_
+lhu zero, d50
+neg s3, fn1
+lhu k0, d28
+jal t1
+lsfti s3, 1
+b_loop: not s0, fn1
+lw k0, d122
+f_next: xori s2, t2, 1
+b_loop: set fn0, d105
+set fn0, 2147483647
+set t3, d48
+rsfti ar, t3, 6
+sw sp, d126
+b_loop: jal fn19_
+set sp, d100
+set t3, 2147483647
+set t0, d59
+f_next: jmp ra
+fn51_: add t0, t0, t1
+b_loop: jmp b_loop
+set t1, d73
+set s0, 5
+b_loop: jmp b_loop
+neg sp, ar
+multi ra, fn1, 5000
+b_loop: divi ra, s0, 100
+set s2, 2147483647
+beq fn0, zero, fn52_
+set s0, d82
+lw t2, d116
+b_loop: jmp b_loop
+div s2, fn0, fn1
+jal t1
+b_loop: sh s2, d11
+b_loop: set t1, 1000
+and fn0, ra
+set s2, d3
+rsftia gp, ra, 26
+set k0, 0
+f_next: multu s3, zero, ra
+set s3, -70000
+bgr t2, s1, fn50_
+jal ext_fn
+multi sp, k0, -1
+f_next: jmp ra
+fn52_: add t0, t0, t1
+b_loop: jmp b_loop
+lh fn1, d19
+lw ra, d71
+nor fn1, s2, gp
+lbu t0, d42
+bgr ar, t2, fn54_
+jal fn8_
+jal ra, t0
+jal fn11_
+bge k0, fn1, fn51_
+set fn1, -5
+f_next: jal fn118_
+bgru t3, t0, fn50_
+lbu k0, d129
+b_loop: jal ra, t0
+set gp, d141
+lsfti ra, 5
+f_next: jal ra, t0
+jal fn94_
+addi sp, -4
+b_loop: jmp f_next
+jal ra, t0
+jal fn26_
+sw s3, d118
+rsftia t2, s1, 18
+f_next: jmp ra
+fn53_: add t0, t0, t1
+jal fn69_
+set s2, d42
+jal ext_fn
+b_loop: sb k0, d37
+sb t3, d44
+b_loop: bgr t3, t2, fn51_
+set ar, 2147483647
+rsft sp, zero, zero
+b_loop: jmp f_next
+rsfta ra, ra, s3
+neg s2, t3
+set gp, -5
+lsfti ar, sp, 1
+greu t3, fn1, s0
+bgeu t2, s1, fn51_
+b_loop: sb k0, d0
+jal fn101_
+neg s0, zero
+f_next: lw fn0, zero, 49
+neg fn0, t0
+jal fn27_
+set k0, d128
+b_loop: jmp f_next
+divi ra, gp, 5000
+b_loop: sw ar, d125
+f_next: jmp ra
+fn54_: add t0, t0, t1
+addi gp, k0, 1
+rsfta s1, ar
+bgr ar, s1, fn54_
+b_loop: set s3, 0
+bgeu gp, t0, fn53_
+lsfti t2, sp, 6
+lw k0, ar, -35
+sw fn0, d85
+f_next: jmp f_next
+xori fn0, t2, 0
+nand zero, k0, s1
+lw fn1, t2, 25
+b_loop: jmp b_loop
+b_loop: jal fn90_
+bne fn0, s0, fn54_
+addi gp, -6
+set zero, d79
+grt ar, s1, fn1
+jal ra, t0
+rsftia s1, t0, 6
+multu k0, gp
+set fn1, 1000
+f_next: set zero, d82
+b_loop: jmp b_loop
+jal t1
+f_next: jmp ra
+fn55_: add t0, t0, t1
+set fn1, d40
+lhu t1, d69
+set ar, d57
+b_loop: jmp b_loop
+jal t1
+addi gp, -13
+sub ar, k0, zero
+sw ar, gp, -78
+not s2, s3
+set t1, 5
+b_loop: jmp b_loop
+neg gp, gp
+bne sp, ra, fn55_
+set t3, d19
+b_loop: jmp b_loop
+neg sp, s0
+b_loop: xori s2, fn1, 1
+not zero, s2
+gre s3, t0
+lhu s2, d28
+lw t2, t2, -40
+lw k0, t3, 64
+jal ext_fn
+sw ar, t1, -85
+set t1, 2147483647
+f_next: jmp ra
+fn56_: add t0, t0, t1
+rsfti fn0, zero, 19
+lsfti t0, 8
+sub ra, s2
+bne fn0, t2, fn56_
+sw s1, fn0, 3
+lw s3, fn1, 53
+b_loop: sw ra, zero, 76
+addi ra, 14
+jal ra, t0
+eql s2, fn1, sp
+f_next: set s0, d3
+bge s2, s1, fn56_
+rsftia zero, t2, 0
+jal ext_fn
+lsfti k0, 2
+xori t1, s2, 100
+divi t1, s2, -8000
+f_next: set s2, d55
+b_loop: jmp b_loop
+jal t1
+sw sp, k0, -36
+f_next: sw zero, s3, 40
+b_loop: ori ra, t1, 1
+set t0, d71
+bgeu s0, ar, fn54_
+f_next: jmp ra
+fn57_: add t0, t0, t1
+f_next: sh fn1, d76
+b_loop: sw t2, fn1, 61
+mult s0, t2, fn0
+set t2, -5
+b_loop: jmp b_loop
+sw zero, d5
+mult s1, t3
+set s1, 5
+beq zero, ar, fn57_
+sw s3, d99
+lbu gp, d79
+sw s0, t0, -87
+rsfti ra, fn0, 12
+jal fn112_
+jal ext_fn
+f_next: jmp f_next
+multi t0, fn0, 100
+divu s2, fn1
+neg fn0, fn1
+b_loop: eql t3, fn0, t2
+b_loop: jmp b_loop
+sh t3, d148
+b_loop: jmp b_loop
+lh t3, d45
+set t1, 1000
+f_next: jmp ra
+fn58_: add t0, t0, t1
+set t3, 0
+lsfti s2, gp, 28
+lw fn1, d56
+lw k0, gp, 63
+or s3, s3, ra
+set s2, d28
+grt gp, s0, t3
+lw t1, sp, 18
+addi t1, 14
+not s1, s1
+set fn1, 2147483647
+neg fn1, s1
+set s3, 5
+b_loop: jmp b_loop
+neql gp, t1
+b_loop: jmp f_next
+sb ra, d31
+b_loop: set k0, d101
+jal ext_fn
+jal fn32_
+set t1, 5
+jal fn16_
+and zero, t0, s1
+b_loop: bgru s1, s3, fn58_
+jal fn90_
+f_next: jmp ra
+fn59_: add t0, t0, t1
+addi ar, -1
+multi k0, t0, 100
+jal ext_fn
+xnor t1, t3, t3
+addi t2, 1
+jal ra, t0
+b_loop: divu fn0, k0, s2
+b_loop: set fn0, d96
+lbu zero, d64
+b_loop: bgeu ra, fn0, fn60_
+lb s2, d22
+jal ra, t0
+nor t0, zero, s2
+addi t2, -1
+f_next: jal fn37_
+f_next: rsft zero, gp, s1
+jal fn107_
+set s2, d48
+b_loop: jmp b_loop
+set t3, d16
+bne t0, t3, fn59_
+sw sp, d116
+b_loop: jmp b_loop
+gre s2, t3, t1
+lb t2, d141
+f_next: jmp ra
+fn60_: add t0, t0, t1
+set sp, 1000
+addi s2, 4
+sw s0, fn0, -82
+not fn0, ar
+jal fn32_
+lsfti ra, 9
+sw zero, s0, 21
+f_next: sw fn1, gp, -48
+jal ra, t0
+sh s1, d131
+jal fn12_
+bne fn0, t3, fn62_
+lh t0, d140
+addi sp, -4
+set ra, d82
+addi t2, -5
+b_loop: jmp b_loop
+lh t1, d42
+lw zero, gp, -36
+set t1, 5
+sw sp, t2, 19
+sw t0, fn0, 53
+b_loop: jal ra, t0
+jal fn46_
+jal ra, t0
+f_next: jmp ra
+fn61_: add t0, t0, t1
+sw s2, d36
+b_loop: jmp b_loop
+divu ar, t2, t0
+b_loop: neg s0, t0
+bgr fn1, t2, fn63_
+set s3, 2147483647
+lb s0, d139
+divi zero, ra, 1
+sw k0, d148
+bgr fn0, fn0, fn61_
+f_next: neg t2, sp
+jal fn49_
+lh t1, d87
+grtu ar, fn0, ar
+b_loop: jmp b_loop
+nand fn1, s2, t3
+jal fn84_
+set zero, d55
+bgeu k0, sp, fn61_
+b_loop: jal fn66_
+lh s3, d89
+addi ra, -16
+neg ar, fn1
+b_loop: neg t3, ar
+lh fn1, d97
+f_next: jmp ra
+fn62_: add t0, t0, t1
+multui k0, t1, 0
+lw t2, fn0, 97
+jal ra, t0
+neg t2, zero
+or ra, fn0
+b_loop: jmp b_loop
+b_loop: sw s0, fn0, -78
+beq t0, t1, fn61_
+set gp, d148
+b_loop: lw s2, t3, 77
+lw gp, t1, 61
+b_loop: jal fn118_
+jal fn76_
+set ra, d5
+set gp, d92
+grtu gp, s1, s2
+b_loop: neql s1, fn1, s3
+lsfti s0, ar, 2
+not t2, k0
+sb t3, d119
+lw gp, t2, 19
+divu t0, s3, k0
+bne ra, t2, fn63_
+bgr t0, t0, fn64_
+set s3, -5
+f_next: jmp ra
+fn63_: add t0, t0, t1
+jal t1
+sw ar, d42
+jal ra, t0
+set sp, 1000
+lw s2, s3, 70
+bge s1, s1, fn62_
+set fn1, d48
+lw t2, s1, -68
+addi gp, -9
+f_next: jal ra, t0
+addi zero, fn1, 5000
+b_loop: jmp b_loop
+lhu k0, d126
+lw t2, t2, -84
+sw fn0, t2, -83
+neg s0, s1
+multi s1, t1, 100
+lw fn0, d92
+b_loop: addi fn0, -11
+div s0, s1, s2
+addi k0, 0
+lw gp, s1, -88
+addi fn1, 14
+f_next: rsftia s2, t2, 22
+sw zero, t3, 26
+f_next: jmp ra
+fn64_: add t0, t0, t1
+neql s3, ra, t1
+ori gp, s1, 1
+b_loop: set s0, d129
+bne s3, s0, fn63_
+set t1, -70000
+set s0, d96
+set s0, d44
+sb gp, d145
+set s1, 1000
+addi ar, -8
+sw fn0, gp, -93
+multi fn0, t0, 7
+b_loop: rsfta sp, fn1, s0
+jal ext_fn
+f_next: multu s2, ar, t0
+jal fn35_
+lhu sp, d139
+f_next: beq s2, ar, fn62_
+lbu s1, d2
+jal fn20_
+jal fn80_
+not s0, gp
+lh t0, d47
+multi sp, s2, 100
+bgru ra, sp, fn62_
+f_next: jmp ra
+fn65_: add t0, t0, t1
+jal fn18_
+sb gp, d82
+sb fn0, d72
+f_next: bgr t0, fn0, fn66_
+b_loop: neg ra, sp
+rsft ra, k0, gp
+bne fn1, s3, fn65_
+sh fn0, d83
+b_loop: jmp b_loop
+beq sp, t0, fn63_
+set s2, d9
+xor zero, zero
+b_loop: jmp b_loop
+b_loop: xori s3, s2, 1
+b_loop: set s3, 1000
+addi t3, 11
+add s3, ar, fn0
+lsfti t1, 3
+lsft fn0, gp, s0
+bgr ra, t1, fn64_
+sw k0, d12
+addi s1, s0, 100
+jal t1
+addi ra, -5
+b_loop: neql ra, t1
+f_next: jmp ra
+fn66_: add t0, t0, t1
+addi ra, fn1, 100
+sub t2, ar, k0
+b_loop: jmp b_loop
+jal t1
+set t1, 123456789
+f_next: set ar, 1000
+addi s1, -5
+add gp, t2
+bge t2, s3, fn65_
+addi t2, -6
+b_loop: jmp b_loop
+divi s2, t3, 7
+divu s0, t0
+jal ra, t0
+set s2, d64
+jal fn62_
+lb zero, d3
+set t1, 2147483647
+lbu gp, d21
+set gp, d46
+addi t3, 10
+sh zero, d136
+jal fn58_
+bgr gp, t3, fn67_
+not fn1, k0
+f_next: jmp ra
+fn67_: add t0, t0, t1
+multui s2, fn0, 8000
+f_next: rsfti sp, s2, 6
+nor fn1, s1, t2
+f_next: bgr sp, zero, fn65_
+xor t2, t2, t2
+xnor sp, fn0
+jal ra, t0
+divi fn1, zero, -8000
+set s0, 123456789
+b_loop: jal fn92_
+set t2, 0
+rsfta fn1, fn0
+or t2, zero, gp
+addi t1, 14
+sh fn1, d21
+b_loop: jmp b_loop
+neg gp, fn0
+b_loop: jmp b_loop
+b_loop: divui zero, s3, 8000
+b_loop: jmp b_loop
+lsfti s2, t3, 3
+lw ar, d42
+sw t0, k0, -89
+not ar, ra
+lb s2, d39
+f_next: jmp ra
+fn68_: add t0, t0, t1
+rsft fn1, t2
+not gp, fn0
+addi s1, 6
+addi k0, 7
+b_loop: jmp b_loop
+f_next: xnor s1, t1, fn0
+not ar, t1
+jal fn83_
+lsfti ra, 0
+set t3, 123456789
+addi t3, 10
+bge t1, ra, fn68_
+not ra, t0
+grt ra, fn0, s2
+lhu t1, d24
+set s2, 123456789
+lsfti zero, fn1, 16
+b_loop: set s1, -5
+rsft ar, s3, ar
+set t3, 2147483647
+sb t3, d27
+jal ext_fn
+gre s0, k0
+f_next: sh s0, d95
+sw fn0, sp, -91
+f_next: jmp ra
+fn69_: add t0, t0, t1
+set t2, 1000
+jal ext_fn
+lhu t1, d134
+beq s0, ra, fn68_
+jal ra, t0
+bgru t3, ra, fn67_
+b_loop: and sp, s0
+add fn1, t2, s3
+set k0, 1000
+f_next: set t1, d52
+not t0, t3
+rsft s1, fn1
+xori fn0, sp, 7
+beq ar, s3, fn70_
+and t0, t2
+lh fn0, d28
+not t0, s2
+addi s2, -1
+neg t0, s3
+addi s0, 8
+lw s2, s2, 21
+lw ra, s2, 29
+jal t1
+set k0, d11
+set sp, d99
+f_next: jmp ra
+fn70_: add t0, t0, t1
+b_loop: not s1, t2
+not t1, t3
+set t1, 123456789
+lsfti gp, 6
+jal ra, t0
+b_loop: nor t2, gp, t3
+beq gp, ra, fn71_
+jal t1
+b_loop: set s1, d85
+f_next: jal ra, t0
+xnor ra, fn0, gp
+b_loop: jmp b_loop
+set t3, 1000
+sh s3, d97
+sw ar, fn1, -58
+neql gp, ra
+sw ra, fn1, 100
+sw s1, s2, 55
+lw gp, s1, 90
+b_loop: ori gp, s2, 100
+b_loop: jmp b_loop
+lsfti k0, 14
+jal fn13_
+b_loop: jmp b_loop
+rsft ra, ra, fn0
+f_next: jmp ra
+fn71_: add t0, t0, t1
+b_loop: jal fn83_
+sw ar, t0, 75
+sw sp, d32
+lhu s3, d12
+addi t3, 12
+bne gp, gp, fn71_
+sb t1, d63
+multi gp, ra, 1
+b_loop: jmp b_loop
+set k0, -70000
+lh t1, d104
+jal ext_fn
+jal ext_fn
+lsfti zero, 10
+b_loop: sb s3, d80
+b_loop: jmp b_loop
+b_loop: set s0, 123456789
+grt s3, s0, t0
+set ar, 2147483647
+jal t1
+jal t1
+sw s2, d92
+b_loop: set s1, d125
+set fn1, d126
+lw s1, d44
+f_next: jmp ra
+fn72_: add t0, t0, t1
+lw ra, fn0, 64
+b_loop: set s2, -5
+addi fn0, sp, -300
+b_loop: jmp b_loop
+neg ra, s1
+b_loop: jmp b_loop
+multui ar, s0, 0
+addi t2, -9
+bne t0, s0, fn73_
+lw k0, d130
+not t1, s3
+b_loop: bgeu ra, s2, fn72_
+addi gp, -15
+addi s2, -1
+jal ra, t0
+addi t3, -15
+b_loop: lw ar, d48
+set k0, 0
+set s1, d131
+addi ar, k0, -8000
+lw fn0, d13
+b_loop: lh k0, d107
+sb fn0, d36
+addi t3, 5
+jal ext_fn
+f_next: jmp ra
+fn73_: add t0, t0, t1
+lw ar, d13
+sb t1, d108
+not ra, fn0
+jal fn93_
+addi t2, -3
+neg t2, gp
+add t3, t3
+f_next: jal fn55_
+divui zero, s2, 1
+set t2, d111
+rsftia s0, ra, 7
+or t0, t1, s1
+sw t0, gp, -85
+set t3, d137
+xor zero, t3
+f_next: set s1, 1000
+f_next: sh sp, d23
+gre fn0, t1, s1
+bgeu s2, s3, fn75_
+jal fn10_
+set gp, d81
+lw fn1, zero, -55
+jal fn114_
+divu t1, fn0
+divui ar, t0, 8000
+f_next: jmp ra
+fn74_: add t0, t0, t1
+set t1, 0
+divu fn0, fn1, fn1
+lw s3, k0, -40
+and fn1, fn1, t3
+not t2, fn0
+f_next: jal fn63_
+gre t1, zero, fn0
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+b_loop: bne t2, sp, fn72_
+grtu t2, sp, t0
+b_loop: jmp b_loop
+sub ra, t2, s1
+set fn1, d106
+bge s1, ar, fn73_
+nand zero, s2
+addi s1, 14
+addi s1, 7
+lhu gp, d10
+f_next: jal fn73_
+lb s3, d42
+b_loop: jmp b_loop
+xnor gp, s3
+bne ar, gp, fn72_
+sw fn1, t2, -11
+f_next: jmp ra
+fn75_: add t0, t0, t1
+sub s1, s1, s0
+greu s3, s3
+set s0, d18
+nand t3, ar
+lw k0, fn1, -85
+sw t2, d56
+jal fn109_
+sw fn0, d146
+b_loop: neg s3, ar
+lh s1, d0
+set ra, -5
+b_loop: jmp b_loop
+neg s2, k0
+grt fn0, s0
+set gp, -5
+rsftia fn1, s1, 0
+b_loop: lsfti k0, 4
+jal ra, t0
+not s0, ar
+b_loop: jal t1
+b_loop: jmp b_loop
+b_loop: xori t2, t3, 1
+set s0, 0
+b_loop: jmp b_loop
+neg k0, s2
+f_next: jmp ra
+fn76_: add t0, t0, t1
+b_loop: set fn1, 1000
+sb k0, d44
+jal ra, t0
+xnor t3, t1
+b_loop: lh t2, d24
+set fn0, d136
+addi t3, 1
+jal fn88_
+bgr ar, s1, fn76_
+or fn1, fn0
+sw zero, d40
+lw zero, d12
+eql s3, t2, fn0
+addi gp, 0
+bge s0, t0, fn74_
+lsfti zero, 11
+sb ra, d4
+lw zero, fn0, 16
+rsfti zero, s0, 2
+neg k0, s3
+b_loop: addi fn1, -7
+gre sp, s3, zero
+set t3, 2147483647
+addi k0, -7
+set s2, -5
+f_next: jmp ra
+fn77_: add t0, t0, t1
+set t0, d117
+lw ar, fn1, 91
+lb zero, d103
+b_loop: jmp b_loop
+ori t0, ra, 8000
+xori zero, zero, 0
+lw s1, ra, -98
+lw ra, d31
+xori s3, s2, 7
+jal fn44_
+bgr s2, fn1, fn76_
+sh s3, d81
+set ra, 5
+ori s1, t3, 0
+addi s2, 8
+set t1, 123456789
+lw t0, t2, 0
+set t2, d84
+sw s0, s0, -100
+sb s2, d28
+neql fn0, t3, t1
+add gp, t0
+not ar, t2
+jal ra, t0
+addi k0, 3
+f_next: jmp ra
+fn78_: add t0, t0, t1
+neg t1, s0
+neql t2, s0
+f_next: set t3, d42
+set fn0, d15
+bgr t2, ra, fn76_
+jal ext_fn
+sub t0, ra
+jal ra, t0
+sub t3, t0, t3
+set ra, -70000
+jal fn24_
+jal fn11_
+b_loop: greu fn1, s1, s2
+b_loop: jmp b_loop
+addi fn0, -8
+lw k0, d73
+bge gp, s2, fn78_
+bgru k0, t1, fn76_
+b_loop: lw t2, s1, -56
+lbu s1, d46
+bgr fn0, sp, fn80_
+addi s0, 15
+lhu ra, d98
+multui gp, t3, 8000
+b_loop: jmp b_loop
+f_next: jmp ra
+fn79_: add t0, t0, t1
+nor s2, gp, zero
+b_loop: jmp b_loop
+addi s1, -5
+add ra, sp, k0
+set ra, d91
+sw s1, fn0, -39
+b_loop: bgr ra, fn1, fn78_
+b_loop: jmp b_loop
+lh t3, d139
+sw fn0, gp, -41
+bgru fn0, t1, fn78_
+jal t1
+gre fn1, ra
+lw k0, s3, 20
+jal fn111_
+sw ra, d136
+jal fn118_
+set sp, 5
+beq sp, gp, fn78_
+set s1, d50
+addi zero, 7
+f_next: set ra, 123456789
+set gp, d60
+b_loop: jmp b_loop
+jal fn86_
+f_next: jmp ra
+fn80_: add t0, t0, t1
+f_next: lhu zero, d20
+b_loop: set sp, 1000
+addi fn1, 12
+b_loop: or zero, t0
+greu ra, gp
+set fn1, 0
+set k0, 0
+b_loop: sub sp, ra
+divi s3, t1, 5000
+b_loop: jal fn9_
+set k0, d126
+set s3, d7
+lbu s0, d128
+beq zero, fn1, fn81_
+lbu t1, d4
+b_loop: beq s0, s3, fn81_
+jal ra, t0
+grtu s0, t2
+ori fn0, ar, 8000
+b_loop: lsfti s3, 15
+jal ext_fn
+b_loop: jmp b_loop
+nor s1, fn0, t0
+bgr k0, fn0, fn79_
+set fn1, d104
+f_next: jmp ra
+fn81_: add t0, t0, t1
+set s1, d137
+set sp, d119
+jal fn29_
+beq t1, gp, fn79_
+b_loop: sw fn0, d142
+lw fn0, gp, 30
+not fn1, k0
+lsfti zero, 8
+jal fn15_
+b_loop: jmp b_loop
+lb fn0, d103
+divi t2, t1, 1
+b_loop: jmp b_loop
+sh t0, d122
+lsfti ra, 12
+sh zero, d30
+lbu gp, d66
+lsfti sp, s0, 0
+add sp, k0, ar
+bne s1, zero, fn80_
+b_loop: set s2, d60
+and s0, fn1, fn0
+set fn0, -5
+jal ra, t0
+b_loop: jmp b_loop
+f_next: jmp ra
+fn82_: add t0, t0, t1
+b_loop: lb t3, d24
+bgeu fn1, sp, fn80_
+b_loop: jmp b_loop
+jal fn95_
+xor s2, ra, ar
+addi t0, -16
+f_next: lsft gp, fn1
+sh t3, d81
+sw s0, s1, -70
+sw fn0, d106
+bgru ra, t2, fn81_
+set t0, d117
+set s3, d38
+bge s2, s3, fn83_
+b_loop: bgeu t1, s0, fn84_
+addi ra, -15
+b_loop: set fn0, -70000
+beq s2, s3, fn81_
+set ra, 2147483647
+b_loop: jal fn71_
+jal fn92_
+lhu zero, d100
+grtu s0, s0, fn0
+multu s2, gp, t2
+jal fn8_
+f_next: jmp ra
+fn83_: add t0, t0, t1
+lw s2, d107
+b_loop: jmp b_loop
+jal t1
+sb s3, d109
+set sp, d6
+lhu t2, d42
+lh ar, d40
+xori t3, t2, 100
+lw ar, fn1, 18
+jal t1
+multi t2, fn1, -1
+lw zero, k0, 97
+sh sp, d146
+rsftia s1, s1, 18
+lw ar, ar, -25
+lw ar, d143
+multui s0, t0, 7
+sw k0, d138
+bgr ar, t1, fn84_
+neg s0, zero
+not fn1, t2
+sb zero, d107
+jal fn83_
+lsfti s2, 10
+add fn1, t1, ra
+f_next: jmp ra
+fn84_: add t0, t0, t1
+jal fn115_
+addi t1, -2
+jal ext_fn
+jal ra, t0
+addi s1, k0, -300
+lb fn1, d110
+lw fn1, t0, -1
+set fn1, d123
+bgr gp, s1, fn83_
+neg sp, k0
+lw ar, fn0, 41
+sh k0, d77
+neg fn1, t1
+f_next: jal ra, t0
+jal ext_fn
+grtu fn0, sp
+lw k0, d93
+jal ext_fn
+b_loop: jmp b_loop
+lsfti gp, 9
+lh fn1, d13
+b_loop: div t0, gp, s2
+add sp, t1
+set k0, d34
+multi fn0, k0, -1
+f_next: jmp ra
+fn85_: add t0, t0, t1
+jal fn8_
+jal fn33_
+nand s1, s1, k0
+divui s3, zero, 1
+f_next: neg s1, fn0
+lw k0, s2, -74
+divi zero, t3, 7
+b_loop: jmp b_loop
+jal ext_fn
+b_loop: lhu k0, d44
+jal fn72_
+multu ar, ra, t3
+sb s1, d44
+set s1, 1000
+bgeu s2, zero, fn87_
+b_loop: neg t2, fn1
+b_loop: jmp b_loop
+jal t1
+not s3, k0
+not ra, gp
+addi fn1, 3
+jal fn41_
+b_loop: jal fn83_
+lw t0, d86
+bgeu gp, s3, fn84_
+f_next: jmp ra
+fn86_: add t0, t0, t1
+set s2, d91
+b_loop: addi s2, 15
+f_next: divui s0, ar, 0
+sb fn1, d65
+f_next: gre s0, fn0, t2
+set t2, -70000
+sw k0, d126
+b_loop: jmp b_loop
+set gp, d87
+neql t3, t0
+jal fn39_
+neg t0, gp
+b_loop: neg t0, ra
+f_next: neql zero, k0
+lw t3, ra, -12
+jal fn35_
+jal fn96_
+b_loop: bgru s1, gp, fn85_
+b_loop: bne k0, s0, fn84_
+b_loop: jal ext_fn
+b_loop: jmp b_loop
+sh t3, d19
+beq t0, sp, fn88_
+not s1, s2
+set fn1, -5
+f_next: jmp ra
+fn87_: add t0, t0, t1
+b_loop: jmp b_loop
+neg t0, gp
+sw k0, t0, 7
+addi s1, -6
+multi fn1, sp, -1
+nor fn0, fn0
+divui t3, s3, 8000
+divui fn0, sp, 100
+set s1, 0
+bne s1, fn0, fn87_
+rsfti t2, t0, 21
+beq t3, s3, fn86_
+eql s1, zero, k0
+eql t2, s1, ar
+set ra, d111
+lsfti zero, 11
+set ar, d73
+set fn0, d96
+jal ra, t0
+set t0, -5
+set s2, 123456789
+jal fn109_
+sw t1, k0, -28
+set t2, 123456789
+neg s3, t1
+f_next: jmp ra
+fn88_: add t0, t0, t1
+set sp, 0
+set k0, 2147483647
+multi t2, k0, 5000
+b_loop: jmp b_loop
+jal fn42_
+lsfti s2, 12
+addi t3, 6
+f_next: set fn0, 123456789
+not s1, s0
+lw t2, k0, -40
+b_loop: jmp b_loop
+divu s3, s3, fn0
+xnor t3, zero
+jal ra, t0
+lw zero, fn0, -28
+set ra, 123456789
+sb s1, d35
+divu zero, s1, fn1
+lbu t2, d22
+gre t3, s3, s3
+multui ra, gp, 7
+lhu sp, d121
+b_loop: jmp b_loop
+lb s1, d126
+jal ra, t0
+f_next: jmp ra
+fn89_: add t0, t0, t1
+lhu ra, d56
+xnor ra, s3, ra
+jal t1
+set s0, d57
+lsfti s0, 3
+addi t3, -7
+lsfti t1, 0
+jal t1
+lbu t2, d27
+rsftia k0, k0, 10
+lbu t0, d131
+b_loop: lsft gp, s2, t3
+b_loop: rsftia ar, zero, 1
+jal t1
+xori gp, t2, 8000
+lsfti s0, 10
+neql gp, t2, s0
+sh ra, d71
+divu sp, ra
+b_loop: set t3, 0
+set k0, d58
+f_next: set ra, d67
+greu t1, t1
+bge t0, sp, fn89_
+lhu sp, d3
+f_next: jmp ra
+fn90_: add t0, t0, t1
+b_loop: addi k0, t2, 100
+jal ext_fn
+f_next: multi fn0, gp, 5000
+sb gp, d49
+b_loop: divui fn1, s1, 7
+set zero, -70000
+lh fn0, d66
+not s2, sp
+lb s0, d76
+jal fn12_
+beq k0, k0, fn89_
+not s2, t0
+lw t2, t0, -67
+b_loop: jal t1
+b_loop: jmp b_loop
+xori s0, zero, 1
+b_loop: jmp b_loop
+lbu s3, d62
+b_loop: sw s3, fn0, -85
+not zero, t1
+f_next: set ra, -5
+lsfti s3, 11
+b_loop: addi t2, -4
+lsfti t1, 13
+lbu ra, d28
+f_next: jmp ra
+fn91_: add t0, t0, t1
+set zero, d23
+multu t2, s1, ar
+b_loop: bgr s2, gp, fn90_
+set s1, d18
+sw t1, t1, 16
+multi t0, t2, -300
+lw s3, d14
+b_loop: rsft fn0, t1
+b_loop: jal ra, t0
+sw ar, gp, 25
+lsfti t0, 4
+sb fn0, d111
+not s2, t3
+bgeu s1, ar, fn91_
+grtu fn0, sp, s2
+set k0, 2147483647
+lw zero, s2, 60
+addi ra, -3
+jal fn36_
+multu t0, ra, s3
+xor t1, s3, k0
+divui gp, sp, 0
+b_loop: jal fn67_
+b_loop: not gp, t2
+set t2, d31
+f_next: jmp ra
+fn92_: add t0, t0, t1
+b_loop: set s3, 1000
+sw t3, zero, 28
+lh t0, d46
+set t1, d2
+beq fn0, fn1, fn91_
+addi s0, 12
+sh gp, d129
+add fn0, s0
+lsfti sp, 0
+bge t3, fn0, fn94_
+set s0, 123456789
+jal fn43_
+set s1, 2147483647
+set s3, 2147483647
+grt fn1, s3, zero
+lh t2, d58
+nor s2, fn1
+sw t3, d63
+set ar, -5
+sw s2, s3, -56
+addi ar, -6
+or gp, fn1
+jal fn93_
+set zero, d33
+beq t2, fn1, fn92_
+f_next: jmp ra
+fn93_: add t0, t0, t1
+lw t3, d20
+b_loop: grtu s1, s2, s2
+divui t2, fn1, 100
+xnor fn0, t3
+multi k0, fn0, 7
+lbu s0, d45
+lsfti s1, t3, 9
+rsftia t1, s0, 29
+neql gp, t2, s0
+grtu t1, t0
+bgru k0, zero, fn91_
+f_next: bgeu fn1, s0, fn95_
+not fn0, gp
+lw fn1, k0, -22
+bgr zero, t0, fn92_
+not s0, t1
+bgr t0, s2, fn92_
+jal fn2_
+sw s3, t3, -63
+addi ar, t1, -300
+jal t1
+lw t3, zero, 28
+set fn0, d3
+addi s0, 5
+addi k0, s2, 1
+f_next: jmp ra
+fn94_: add t0, t0, t1
+b_loop: jmp b_loop
+sw ar, t2, 40
+lw fn0, ar, -82
+jal t1
+jal ra, t0
+multu gp, t0
+set t1, -5
+set sp, 5
+lw ra, d14
+jal fn64_
+b_loop: jmp b_loop
+jal ra, t0
+jal fn17_
+b_loop: jmp b_loop
+ori s0, s2, 100
+set t0, 123456789
+bge ar, ra, fn96_
+sw t0, s3, 14
+bgr t1, fn0, fn96_
+lh t0, d89
+bgeu s1, ar, fn93_
+jal t1
+addi t1, fn1, -8000
+rsfta t1, t0, t1
+set ra, d128
+f_next: jmp ra
+fn95_: add t0, t0, t1
+nor s1, t3
+addi t0, s0, 1
+set gp, d44
+jal t1
+b_loop: jal t1
+or s3, t0, fn0
+b_loop: jmp b_loop
+sb ra, d124
+not gp, gp
+sw s0, d44
+jal ext_fn
+b_loop: not fn1, s0
+jal ra, t0
+bgru fn0, s2, fn93_
+rsfti s2, gp, 0
+set fn0, 2147483647
+jal ext_fn
+set fn0, d101
+sb s2, d67
+lw t2, d103
+set ar, 2147483647
+bgeu s2, s0, fn93_
+bgr t0, zero, fn93_
+b_loop: jal fn108_
+set zero, d104
+f_next: jmp ra
+fn96_: add t0, t0, t1
+lw ar, t3, -38
+not s2, k0
+nor s2, s2, fn1
+lsfti k0, fn1, 1
+not t1, s1
+bne ra, sp, fn95_
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+sub t1, s0, gp
+addi s1, 10
+b_loop: sw zero, t1, -85
+sb t0, d144
+multui s0, s0, 7
+set ar, 2147483647
+set t0, d117
+sw t3, d18
+set s3, d68
+jal fn92_
+bgru ra, k0, fn94_
+lw s1, s1, -81
+set gp, 5
+set ar, -70000
+greu s0, zero
+b_loop: set ar, 123456789
+set gp, d66
+f_next: jmp ra
+fn97_: add t0, t0, t1
+b_loop: jmp b_loop
+jal ext_fn
+lw gp, t0, -20
+not s1, t1
+set fn0, d101
+bgr sp, k0, fn95_
+sw t0, t0, -48
+sw zero, fn1, -25
+b_loop: jmp b_loop
+b_loop: rsft t0, s3, k0
+lbu zero, d68
+addi s1, ar, 5000
+set fn0, d83
+b_loop: xnor gp, s0
+b_loop: lh t2, d9
+addi s0, -9
+lsfti t3, 3
+f_next: lh t0, d133
+b_loop: lsfti zero, s0, 7
+jal fn37_
+jal ext_fn
+xor t2, zero
+lw fn1, s0, 16
+jal ext_fn
+b_loop: jmp f_next
+f_next: jmp ra
+fn98_: add t0, t0, t1
+jal ext_fn
+set sp, d85
+lw ra, d69
+jal ra, t0
+set s0, 5
+lw s3, t0, 20
+set zero, 5
+bgeu ra, gp, fn96_
+greu s2, fn1, sp
+set s0, 2147483647
+addi t3, 7
+add k0, zero
+b_loop: rsftia t0, s3, 3
+xori ra, t1, 100
+bgeu s2, zero, fn99_
+set ra, 2147483647
+b_loop: jmp b_loop
+set s2, -5
+sw ar, fn0, -76
+b_loop: lh gp, d78
+f_next: or k0, sp, s1
+sh t1, d60
+lbu s0, d60
+jal ra, t0
+neg s3, k0
+f_next: jmp ra
+fn99_: add t0, t0, t1
+addi k0, 15
+addi t3, -16
+multi k0, t2, 1
+bne zero, s2, fn101_
+lb gp, d134
+b_loop: rsft zero, s2, fn0
+div s2, sp
+b_loop: neg ra, s0
+bge s2, t1, fn98_
+not s1, fn0
+b_loop: lhu gp, d8
+bgr t1, s0, fn101_
+lb ar, d58
+jal fn32_
+b_loop: jmp b_loop
+bne fn1, t2, fn98_
+nand fn1, sp, s2
+b_loop: div s0, gp, s3
+divi t0, ra, 1
+multui s1, ar, 7
+b_loop: jmp b_loop
+greu t1, ar, t1
+lw s2, ar, -30
+neg gp, s1
+lw t0, d146
+f_next: jmp ra
+fn100_: add t0, t0, t1
+sw fn0, d51
+b_loop: sw t0, t0, -90
+jal fn59_
+addi t2, -14
+b_loop: jmp f_next
+lw t0, t1, 96
+xor s2, fn0, gp
+bne s2, sp, fn98_
+set sp, d132
+div ra, zero, s1
+sw t1, fn1, 78
+set zero, d144
+sb t2, d89
+f_next: divui t0, k0, 7
+b_loop: jmp b_loop
+lsfti s1, 3
+lsfti s0, zero, 11
+f_next: jal fn38_
+divu t2, t0
+b_loop: set t2, d122
+lb t0, d128
+f_next: set s3, d17
+not t3, s2
+set s1, d61
+f_next: lw t3, s3, -50
+f_next: jmp ra
+fn101_: add t0, t0, t1
+bne zero, t0, fn99_
+and t3, zero, zero
+b_loop: jmp f_next
+divi t1, ra, 100
+b_loop: jmp b_loop
+lw zero, t0, -83
+b_loop: jmp b_loop
+sh sp, d5
+divi gp, sp, 7
+f_next: jal ext_fn
+f_next: bgr t0, ar, fn100_
+b_loop: bgru ar, ar, fn99_
+set t0, 1000
+rsftia t2, s2, 8
+neg k0, s3
+b_loop: jal fn49_
+multu k0, s2, t1
+b_loop: jmp b_loop
+divi s1, sp, -1
+grt zero, s1, t1
+set sp, -5
+greu fn1, gp, k0
+jal fn82_
+sw t2, d144
+bne s0, zero, fn103_
+f_next: jmp ra
+fn102_: add t0, t0, t1
+set zero, d53
+sw t0, d97
+lsfti fn1, 9
+sw gp, t3, -89
+jal ext_fn
+sh fn1, d48
+bgru ra, t3, fn103_
+rsfti s0, s0, 8
+sh t3, d66
+xnor fn0, gp, sp
+f_next: sw gp, t0, 48
+bgru ra, s2, fn103_
+gre ar, t1, k0
+set t2, 123456789
+lbu zero, d72
+bne fn0, ra, fn102_
+sw s0, d34
+b_loop: lbu ra, d108
+sw sp, zero, -99
+lsfti t3, 9
+b_loop: bgr s0, ra, fn100_
+sw s2, s1, -37
+lsfti t2, fn0, 0
+sh fn1, d135
+and s0, fn0, ra
+f_next: jmp ra
+fn103_: add t0, t0, t1
+b_loop: sw fn1, d123
+not sp, sp
+set gp, -5
+neg fn1, t1
+multu gp, ra
+eql ar, s0
+b_loop: jal ext_fn
+b_loop: jmp f_next
+jal fn48_
+set s1, d118
+set s3, d10
+set t0, d23
+multui t0, ar, 8000
+b_loop: jmp b_loop
+eql t3, fn0, zero
+jal fn117_
+bge gp, t0, fn104_
+lb ar, d88
+sw s2, d60
+jal fn22_
+addi s0, 13
+set s0, 5
+set t1, d107
+bne s2, sp, fn101_
+addi gp, -1
+f_next: jmp ra
+fn104_: add t0, t0, t1
+sw k0, k0, 54
+divi s0, gp, -8000
+divi s3, fn1, -300
+jal fn115_
+sw fn1, d105
+grtu ra, s2
+b_loop: jal t1
+gre s3, ar, s3
+lbu s2, d44
+set t2, d14
+grt t3, fn0
+and t3, s3, s2
+lw s1, ar, 97
+b_loop: not t2, zero
+eql sp, fn1
+lsfti gp, 13
+set fn0, 123456789
+b_loop: jmp b_loop
+neql s2, t0, zero
+lw t2, t3, 22
+b_loop: sw t0, d21
+bge fn0, s3, fn102_
+jal fn20_
+grtu sp, t1
+add sp, gp, sp
+f_next: jmp ra
+fn105_: add t0, t0, t1
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+jal t1
+b_loop: jmp b_loop
+jal ra, t0
+f_next: mult fn0, ra
+jal ext_fn
+add gp, fn0, s1
+rsfta ra, ar
+grtu s0, zero, fn0
+b_loop: lw k0, s1, -9
+div ar, t3, s0
+lh sp, d42
+lb zero, d125
+bgru s2, sp, fn103_
+addi t3, 15
+jal ra, t0
+lw t3, fn1, -77
+neg t3, zero
+multu fn1, s0
+sb s1, d67
+xnor ra, zero, t2
+sw s1, d121
+b_loop: bgr gp, t3, fn107_
+jal ext_fn
+f_next: jmp ra
+fn106_: add t0, t0, t1
+addi ra, t3, 100
+lw gp, d103
+sb s2, d51
+b_loop: sub ar, t0
+set sp, d98
+set gp, -70000
+addi t3, 11
+f_next: div t2, s0, t2
+and ar, t0, t0
+addi s2, s1, 1
+jal fn62_
+multu s1, zero
+f_next: divu t3, s3, s2
+grt s3, ar, ra
+b_loop: rsfta ar, s3
+f_next: sb s2, d41
+b_loop: not k0, t1
+not t2, k0
+b_loop: jmp b_loop
+b_loop: jal t1
+grtu s1, s1
+lw s0, t3, 88
+grtu t2, s1
+sw fn0, d148
+lsfti fn1, 15
+f_next: jmp ra
+fn107_: add t0, t0, t1
+addi s3, 6
+divu ar, k0
+set t2, d137
+jal fn15_
+jal fn85_
+lsfti t2, 9
+jal ra, t0
+b_loop: jmp b_loop
+sb sp, d109
+nor gp, t1, t1
+lhu ar, d36
+not ra, t1
+divui t0, s1, 0
+sh s1, d116
+set ar, 0
+b_loop: set fn0, d21
+sw sp, fn0, -12
+beq s3, fn1, fn105_
+b_loop: set s2, 1000
+rsft k0, t2
+lsfti ra, 9
+b_loop: jmp b_loop
+addi t0, 3
+gre ar, s3, t2
+lsfti s1, 7
+f_next: jmp ra
+fn108_: add t0, t0, t1
+sw t2, ra, -62
+lw t3, fn1, 78
+neg zero, fn1
+lsfti s0, s1, 13
+f_next: jal fn74_
+rsft s3, k0, s0
+bne gp, ar, fn108_
+jal t1
+b_loop: jmp b_loop
+lw t2, zero, -77
+set t3, d78
+jal ext_fn
+set k0, d3
+b_loop: jmp b_loop
+greu gp, k0, fn0
+not s2, ra
+divui gp, t3, 100
+sh gp, d108
+not fn1, t1
+grt s1, ra, s2
+bgr s3, zero, fn107_
+bgr s1, ra, fn110_
+not s1, t0
+set t3, d54
+b_loop: addi t2, 10
+f_next: jmp ra
+fn109_: add t0, t0, t1
+addi t3, 8
+addi s3, -5
+jal t1
+b_loop: jmp f_next
+lhu t2, d44
+multi t2, sp, 7
+f_next: ori t3, s2, 1
+neg s2, t1
+b_loop: jmp b_loop
+and ar, s1, ra
+jal fn105_
+jal fn5_
+beq t2, fn0, fn109_
+sh fn0, d6
+lsfti t1, 7
+set fn1, d4
+lsfti s1, t1, 26
+lsfti s0, 13
+eql s0, fn0, s3
+jal fn23_
+sw t0, t2, -38
+addi fn0, -14
+eql t0, t1, t1
+bne t1, s1, fn111_
+b_loop: set fn1, d77
+f_next: jmp ra
+fn110_: add t0, t0, t1
+jal fn116_
+sb fn0, d115
+neg fn1, s1
+bgeu k0, fn1, fn111_
+neg k0, fn1
+jal t1
+bge fn1, ar, fn110_
+set s1, d99
+set zero, d127
+not fn0, gp
+bgeu zero, s1, fn110_
+gre fn0, s2, t2
+b_loop: jal ra, t0
+set t2, d63
+sw sp, d10
+lw t3, d37
+bne gp, ar, fn108_
+multi gp, s0, 7
+jal ext_fn
+f_next: addi fn1, -10
+neg ar, s1
+sw s0, fn0, 57
+sh k0, d37
+set s1, d67
+addi t1, -5
+f_next: jmp ra
+fn111_: add t0, t0, t1
+beq s3, s1, fn113_
+bge k0, ar, fn110_
+set gp, d63
+set fn0, d103
+lb fn0, d16
+set s1, d135
+not s1, k0
+lsfti t1, 2
+set t0, d38
+not s2, zero
+b_loop: sb ar, d26
+not t1, ar
+set k0, d36
+set s3, d16
+multui s0, s1, 0
+sb s2, d107
+set s1, d53
+sw s3, d138
+bgru s1, zero, fn109_
+addi zero, -3
+b_loop: jmp f_next
+lsfti gp, 6
+bgeu t3, t1, fn112_
+lw s0, k0, -98
+b_loop: jmp b_loop
+f_next: jmp ra
+fn112_: add t0, t0, t1
+b_loop: set gp, d99
+xori s0, s0, 100
+addi s1, t3, -8000
+rsfti ar, t3, 28
+b_loop: grtu fn0, s2
+set sp, -70000
+sw fn1, sp, -100
+sw s3, d70
+xor t2, t0
+addi k0, -12
+jal fn69_
+sh k0, d121
+sh sp, d6
+add k0, s2, s1
+not zero, ar
+neg fn1, zero
+set fn1, 1000
+set gp, d89
+b_loop: jmp b_loop
+sw t1, s2, 65
+sh gp, d104
+b_loop: jmp b_loop
+lhu t1, d99
+b_loop: not ra, fn1
+addi t3, 12
+f_next: jmp ra
+fn113_: add t0, t0, t1
+sh s1, d76
+set fn1, d147
+set gp, 123456789
+lw zero, d64
+b_loop: jmp b_loop
+b_loop: sw t0, gp, -28
+lb t0, d128
+set sp, d54
+b_loop: jmp b_loop
+bge s3, s0, fn111_
+rsfta ar, s1, zero
+set t0, d127
+b_loop: jmp b_loop
+beq t0, s0, fn112_
+sw s1, ra, -4
+divi sp, sp, 100
+b_loop: jmp b_loop
+set t3, 5
+set gp, -5
+bgeu s1, s2, fn115_
+b_loop: set fn1, d71
+sb fn0, d105
+lb zero, d34
+addi t0, -5
+f_next: lhu fn0, d86
+f_next: jmp ra
+fn114_: add t0, t0, t1
+jal fn116_
+sw sp, d11
+xor s2, gp
+xnor sp, t1, s2
+lb t2, d41
+jal fn65_
+b_loop: neg ar, t3
+lw fn0, fn1, -66
+or fn0, t3
+not fn1, zero
+jal fn60_
+not t3, t2
+b_loop: ori ra, s1, 0
+sb fn0, d45
+bge s3, t3, fn112_
+f_next: sb s2, d65
+divu s2, s0
+set k0, d66
+b_loop: set ra, d42
+sb s3, d55
+not s2, t1
+set s3, d140
+jal fn75_
+not fn0, sp
+sb s0, d88
+f_next: jmp ra
+fn115_: add t0, t0, t1
+neg s1, gp
+gre t0, ar
+jal t1
+beq k0, gp, fn113_
+b_loop: jmp b_loop
+set s0, d78
+lw s1, ar, 20
+b_loop: jmp b_loop
+b_loop: sb t0, d83
+sw fn0, d92
+set zero, d92
+f_next: bge sp, t0, fn113_
+b_loop: xor fn1, t2
+multui t3, fn1, 100
+sw k0, d116
+addi fn0, -8
+jal fn14_
+lh t1, d115
+set k0, -70000
+b_loop: set s2, d64
+beq t0, s3, fn113_
+f_next: jal t1
+jal fn66_
+jal ext_fn
+b_loop: lhu s3, d57
+f_next: jmp ra
+fn116_: add t0, t0, t1
+lb s3, d143
+set t3, d114
+f_next: jal t1
+f_next: jmp f_next
+b_loop: jmp b_loop
+lb fn1, d2
+f_next: set sp, -5
+set s3, 123456789
+lw t1, fn0, -40
+b_loop: add s1, t1, ar
+neg gp, k0
+xori gp, fn0, 1
+bgr sp, s2, fn118_
+jal ra, t0
+xor s0, ar, t0
+sh ar, d144
+lh sp, d49
+b_loop: xori fn1, fn1, 0
+jal fn54_
+sw t0, ar, 20
+addi s3, 15
+bgr s0, s0, fn118_
+multu t0, t0
+sw k0, t2, -52
+xor gp, t2, t3
+f_next: jmp ra
+fn117_: add t0, t0, t1
+set sp, d11
+sub k0, t2, s0
+lw t3, d45
+addi zero, -4
+b_loop: jmp b_loop
+b_loop: jmp b_loop
+lsfti s3, 14
+b_loop: jmp b_loop
+bne k0, s0, fn117_
+b_loop: jmp b_loop
+jal ext_fn
+b_loop: jmp b_loop
+f_next: rsftia t0, k0, 9
+bge fn0, fn1, fn119_
+lsfti t2, 6
+b_loop: jal fn81_
+b_loop: set t3, d39
+rsfti ra, gp, 9
+lw s3, k0, 20
+set gp, 5
+sh t0, d102
+b_loop: lw s3, d13
+b_loop: mult ra, fn1, s1
+sb s3, d24
+b_loop: jmp b_loop
+f_next: jmp ra
+fn118_: add t0, t0, t1
+bgeu zero, s0, fn117_
+sw gp, ar, 32
+lsfti s1, s0, 3
+jal ra, t0
+rsfti fn0, t3, 0
+lh t3, d85
+b_loop: bgr zero, t1, fn119_
+neql s3, t1
+sub k0, k0, t1
+b_loop: jmp b_loop
+set sp, d38
+lsfti s3, 4
+b_loop: add ra, s1
+xor gp, t3
+jal t1
+b_loop: jmp b_loop
+b_loop: jmp f_next
+f_next: grtu s3, s0, t2
+sw ar, d29
+bgeu gp, s1, fn118_
+jal ext_fn
+set s0, d28
+b_loop: neg sp, gp
+b_loop: set ar, d109
+sb t2, d113
+f_next: jmp ra
+fn119_: add t0, t0, t1
+b_loop: neql t1, t0, fn0
+b_loop: jmp b_loop
+lw sp, d68
+jal t1
+bgru ra, s0, fn119_
+lw fn0, d16
+bgr zero, t2, fn118_
+rsfti t1, fn1, 15
+bgeu zero, t0, fn119_
+grt t3, s0
+b_loop: jmp b_loop
+b_loop: not t3, s3
+sh t3, d122
+addi k0, -13
+jal fn62_
+bgeu fn1, fn0, fn119_
+set ra, 1000
+sb s1, d61
+neg s0, fn0
+jal fn80_
+lsft ra, gp
+jal ra, t0
+set k0, 2147483647
+b_loop: jmp b_loop
+addi sp, 15
+f_next: jmp ra
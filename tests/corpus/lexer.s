@@ -0,0 +1,31 @@
+//lexer corner cases, lexed but never assembled
+.data
+msg:	.byte 'a', ',', ':'	//chars that look like separators
+hex: .word 0xDEADbeef, -0x10, 0b1011, -0b1, -42, 0
+	.halfword_array 4
+str: "a \"quoted\" string", "back\\slash", ""
+.text
+.global main
+main: add s0, s1, s2
+  addi t0, zero, -1 // trailing comment
+  andi fn0, sp, 0xff
+
+
+  rsftia k0, k1, 3
+  lw ra, hex
+  sw gp, msg
+  beq ar, pg, main
+  r0 r3 r4 r31 s8 t7 fn7
+_under: jmp main
+lbl9abc: set t1, 0x1234
+addix subx lwz sets
+stray ~ ! @ $ %
+	.unknown_directive 1,2,3
+//every keyword, so the backends are compared on every id
+add sub mult div multu divu eql neql grt grtu gre greu lsft rsft rsfta nor nand or and xor xnor
+xori ori andi addi multi divi multui divui lsfti rsfti rsftia neg not
+lw lh lb lhu lbu sw sh sb beq bne bgr bgru bge bgeu jal jmp set
+zero ra sp gp k0 k1 pg ar s0 s1 s2 s3 s4 s5 s6 s7 t0 t1 t2 t3 t4 t5 t6 t7
+fn0 fn1 fn2 fn3 fn4 fn5 fn6 fn7 r1 r2
+.text .data .bss .word .halfword .byte .word_array .halfword_array .byte_array
+.externdata .externex .global .texts .g
@@ -0,0 +1,20 @@
+.data
+counter: .word 5
+arr: .byte_array 16
+zeros: .word 0, 0
+hw: .halfword 7, -3
+.bss
+buf: .word 0
+.text
+.global main
+main: addi s0, zero, 10
+    add s1, s0, s0
+    lw t0, counter
+loop: addi s0, s0, -1
+    bne s0, zero, loop
+    jal func
+    jmp end
+func: sw s1, buf
+    set t1, 0x1234
+end: nor s0, s0, s0
+// back\slash
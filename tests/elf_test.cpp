@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "assemble.h"
+#include "source_buffer.h"
+
+//---elf contents, as ELFIO reads them---//
+struct section_record {
+    std::string name;
+    ELFIO::Elf_Word type;
+    ELFIO::Elf_Xword flags;
+    ELFIO::Elf64_Addr address;
+    ELFIO::Elf_Xword size;
+    ELFIO::Elf_Xword addralign;
+    ELFIO::Elf_Word link;
+    ELFIO::Elf_Word info;
+    ELFIO::Elf_Xword entsize;
+    std::string data;//empty for nobits sections
+
+    bool operator==(const section_record &) const = default;
+};
+
+struct symbol_record {
+    std::string name;
+    ELFIO::Elf64_Addr value;
+    ELFIO::Elf_Xword size;
+    unsigned char bind;
+    unsigned char type;
+    ELFIO::Elf_Half section_index;
+    unsigned char other;
+
+    bool operator==(const symbol_record &) const = default;
+};
+
+struct relocation_record {
+    ELFIO::Elf64_Addr offset;
+    ELFIO::Elf_Word symbol;
+    unsigned type;
+
+    bool operator==(const relocation_record &) const = default;
+};
+
+static std::ostream &operator<<(std::ostream &strm, const section_record &section) {
+    return strm << section.name << " type " << section.type << " flags " << section.flags
+                << " size " << section.size;
+}
+
+static std::ostream &operator<<(std::ostream &strm, const symbol_record &symbol) {
+    return strm << symbol.name << " value " << symbol.value << " size " << symbol.size
+                << " section " << symbol.section_index;
+}
+
+static std::ostream &operator<<(std::ostream &strm, const relocation_record &relocation) {
+    return strm << "offset " << relocation.offset << " symbol " << relocation.symbol << " type "
+                << relocation.type;
+}
+
+struct elf_contents {
+    unsigned char elf_class;
+    ELFIO::Elf_Half type;
+    ELFIO::Elf_Half machine;
+    ELFIO::Elf64_Addr entry;
+
+    std::vector<section_record> sections;
+    std::vector<symbol_record> symbols;
+    std::vector<relocation_record> relocations;
+};
+
+static elf_contents load_elf(const std::filesystem::path &path) {
+    ELFIO::elfio elf;
+    if (elf.load(path.string()) == false)
+        throw std::runtime_error("could not load " + path.string());
+
+    elf_contents contents{elf.get_class(), elf.get_type(), elf.get_machine(), elf.get_entry()};
+    for (const auto &section: elf.sections) {
+        section_record record{section->get_name(),      section->get_type(),
+                              section->get_flags(),     section->get_address(),
+                              section->get_size(),      section->get_addr_align(),
+                              section->get_link(),      section->get_info(),
+                              section->get_entry_size(), {}};
+        if (section->get_type() != ELFIO::SHT_NOBITS && section->get_data() != nullptr)
+            record.data.assign(section->get_data(), section->get_size());
+        contents.sections.push_back(std::move(record));
+
+        if (section->get_type() == ELFIO::SHT_SYMTAB) {
+            const ELFIO::symbol_section_accessor symbols(elf, section.get());
+            for (ELFIO::Elf_Xword i = 0; i < symbols.get_symbols_num(); i++) {
+                symbol_record symbol;
+                symbols.get_symbol(i, symbol.name, symbol.value, symbol.size, symbol.bind,
+                                   symbol.type, symbol.section_index, symbol.other);
+                contents.symbols.push_back(symbol);
+            }
+        }
+
+        if (section->get_type() == ELFIO::SHT_REL) {
+            const ELFIO::relocation_section_accessor relocations(elf, section.get());
+            for (ELFIO::Elf_Xword i = 0; i < relocations.get_entries_num(); i++) {
+                relocation_record relocation;
+                ELFIO::Elf_Sxword addend;
+                relocations.get_entry(i, relocation.offset, relocation.symbol, relocation.type,
+                                      addend);
+                contents.relocations.push_back(relocation);
+            }
+        }
+    }
+
+    return contents;
+}
+
+template<class record_t>
+static void expect_same_records(const std::vector<record_t> &records,
+                                const std::vector<record_t> &reference) {
+    EXPECT_EQ(records.size(), reference.size());
+    for (std::size_t i = 0; i < std::min(records.size(), reference.size()); i++)
+        EXPECT_EQ(records[i], reference[i]) << "entry " << i;
+}
+
+//<name>.ref.elf in the corpus was written by the ELFIO based writer the native writer replaced
+TEST(elf, matches_the_elfio_writer) {
+    for (const auto name: {"a", "p", "g1"}) {
+        SCOPED_TRACE(name);
+        const std::filesystem::path corpus{ASSEMBLER_TEST_CORPUS};
+        const auto source = source_buffer::map_file(corpus / (std::string{name} + ".s"));
+        const auto output = test_output_path(std::string{"_"} + name);
+        assemble(source.view(), output);
+
+        const auto contents = load_elf(output);
+        const auto reference = load_elf(corpus / (std::string{name} + ".ref.elf"));
+
+        EXPECT_EQ(contents.elf_class, reference.elf_class);
+        EXPECT_EQ(contents.type, reference.type);
+        EXPECT_EQ(contents.machine, reference.machine);
+        EXPECT_EQ(contents.entry, reference.entry);
+        ASSERT_FALSE(reference.symbols.empty());
+        ASSERT_FALSE(reference.relocations.empty());
+
+        expect_same_records(contents.sections, reference.sections);
+        expect_same_records(contents.symbols, reference.symbols);
+        expect_same_records(contents.relocations, reference.relocations);
+    }
+}
+
+//---zero data---//
+static const section_record &find_section(const elf_contents &contents, std::string_view name) {
+    for (const auto &section: contents.sections)
+        if (section.name == name) return section;
+    throw std::runtime_error("no section " + std::string{name});
+}
+
+static ELFIO::Elf_Half section_index_of(const elf_contents &contents, std::string_view name) {
+    return &find_section(contents, name) - contents.sections.data();
+}
+
+static const symbol_record &find_symbol(const elf_contents &contents, std::string_view name) {
+    for (const auto &symbol: contents.symbols)
+        if (symbol.name == name) return symbol;
+    throw std::runtime_error("no symbol " + std::string{name});
+}
+
+TEST(elf, zero_data_moves_to_bss) {
+    const auto output = test_output_path();
+    assemble(".data\n"
+             "one: .word 1\n"
+             "zeros: .word 0, 0\n"
+             "implicit: .halfword\n"
+             "array: .byte_array 3\n"
+             "mixed: .byte 0, 2\n",
+             output, {"--zero-data-to-bss"});
+    const auto contents = load_elf(output);
+
+    //only the objects with a nonzero value stay in .data
+    EXPECT_EQ(find_section(contents, ".data").size, 6u);
+    EXPECT_EQ(find_section(contents, ".bss").size, 13u);
+
+    const auto data_index = section_index_of(contents, ".data");
+    const auto bss_index = section_index_of(contents, ".bss");
+    EXPECT_EQ(find_symbol(contents, "one").section_index, data_index);
+    EXPECT_EQ(find_symbol(contents, "mixed").section_index, data_index);
+    EXPECT_EQ(find_symbol(contents, "zeros").section_index, bss_index);
+    EXPECT_EQ(find_symbol(contents, "implicit").section_index, bss_index);
+    EXPECT_EQ(find_symbol(contents, "array").section_index, bss_index);
+}
+
+//---executable layout---//
+TEST(elf, exec_layout_segments) {
+    //.data is empty, its segment only holds .bss
+    const auto output = test_output_path();
+    assemble(".bss\n"
+             "b: .word_array 4\n"
+             ".text\n"
+             ".global start\n"
+             "start: addi s0, zero, 1\n",
+             output, {"--exec-layout"});
+
+    ELFIO::elfio elf;
+    ASSERT_TRUE(elf.load(output.string()));
+    ASSERT_EQ(elf.segments.size(), 2u);
+    for (const auto &segment: elf.segments) {
+        EXPECT_EQ(segment->get_type(), ELFIO::PT_LOAD);
+        EXPECT_EQ(segment->get_align(), 0x1000u);
+        EXPECT_EQ(segment->get_offset() % segment->get_align(),
+                  segment->get_virtual_address() % segment->get_align());
+    }
+
+    const auto &data_segment = elf.segments[1];
+    EXPECT_EQ(data_segment->get_flags(), ELFIO::PF_R | ELFIO::PF_W);
+    EXPECT_EQ(data_segment->get_virtual_address(), elf.sections[".bss"]->get_address());
+    EXPECT_EQ(data_segment->get_file_size(), 0u);
+    EXPECT_EQ(data_segment->get_memory_size(), 16u);
+
+    //the empty .rodata starts no segment and must not share a file offset with one
+    const auto *rodata = elf.sections[".rodata"];
+    ASSERT_EQ(rodata->get_size(), 0u);
+    for (const auto &segment: elf.segments) {
+        const auto begin = segment->get_offset();
+        const auto end = begin + std::max<ELFIO::Elf_Xword>(segment->get_file_size(), 1);
+        EXPECT_FALSE(rodata->get_offset() >= begin && rodata->get_offset() < end);
+    }
+}
+
+//---output that is not a regular file---//
+//the zero arrays are longer than elf_generator::min_zero_run, so they are holes in a regular file
+static constexpr std::string_view zero_run_source = R"(.data
+a: .word 1, 2
+big: .word_array 4096
+c: .byte 7
+.bss
+b: .word_array 16
+.text
+.global start
+start: addi s0, zero, 1
+)";
+
+static std::string read_file(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+TEST(elf, writes_to_a_pipe) {
+    const std::vector<std::vector<std::string>> option_sets = {{}, {"--exec-layout"}};
+    for (const auto &options: option_sets) {
+        SCOPED_TRACE(options.empty() ? "relocatable" : "exec layout");
+        const auto output = test_output_path();
+        assemble(zero_run_source, output, options);
+
+        int fds[2];
+        ASSERT_EQ(pipe(fds), 0);
+        std::string piped;
+        std::thread reader([&] {
+            char chunk[4096];
+            ssize_t nread;
+            while ((nread = read(fds[0], chunk, sizeof(chunk))) > 0) piped.append(chunk, nread);
+        });
+        assemble(zero_run_source, "/proc/self/fd/" + std::to_string(fds[1]), options);
+        close(fds[1]);
+        reader.join();
+        close(fds[0]);
+
+        //the gaps a pipe can't seek over are written as zeros
+        EXPECT_EQ(piped, read_file(output));
+    }
+}
+
+TEST(elf, writes_to_dev_null) {
+    EXPECT_NO_THROW(assemble(zero_run_source, "/dev/null"));
+    EXPECT_NO_THROW(assemble(zero_run_source, "/dev/null", {"--exec-layout"}));
+}
+
+TEST(elf, reports_a_full_device) {
+    //every write to /dev/full fails with ENOSPC
+    EXPECT_THROW(assemble(zero_run_source, "/dev/full"), std::runtime_error);
+}
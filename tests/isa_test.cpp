@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <new>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "asm_lang.h"
+#include "isa.h"
+
+TEST(isa, inst_id_to_string_lut_names) {
+    for (int i = 0; i < (int) isa::inst_id::LAST; i++) {
+        const auto id = (isa::inst_id) i;
+        EXPECT_EQ(isa::inst_id_to_string_lut[id], magic_enum::enum_name(id));
+    }
+}
+
+//the enumerators past LAST (INVALID) must not be written past the end of the table
+TEST(isa, inst_id_to_string_lut_stays_in_bounds) {
+    constexpr std::size_t nentries = (std::size_t) isa::inst_id::LAST;
+    alignas(isa::inst_id_to_string_lut_t) std::array<std::string_view, nentries + 4> storage;
+    static_assert(sizeof(isa::inst_id_to_string_lut_t) == nentries * sizeof(std::string_view));
+
+    storage.fill("guard");
+    auto *lut = new (storage.data()) isa::inst_id_to_string_lut_t;
+
+    for (std::size_t i = nentries; i < storage.size(); i++) EXPECT_EQ(storage[i], "guard") << i;
+    lut->~inst_id_to_string_lut_t();
+}
+
+//decode_many is table driven, the instruction constructor is the reference
+static void expect_decodes_like_constructor(std::span<const uint8_t> bytes,
+                                            isa::encoded_instruction encoded) {
+    std::vector<isa::located_instruction> decoded;
+    isa::decode_many(bytes, decoded);
+    ASSERT_EQ(decoded.size(), 1u);
+
+    const isa::instruction expected(encoded);
+    const isa::instruction &inst = decoded[0].inst;
+    const bool fullword = encoded.size == isa::instruction_size_type::fullword;
+    const uint32_t word = fullword ? encoded.fullword : encoded.halfword;
+
+    EXPECT_EQ(decoded[0].size, encoded.size) << word;
+    ASSERT_EQ(inst.id, expected.id) << word;
+    if (inst.id == isa::inst_id::INVALID) return;
+
+    EXPECT_EQ(inst.format, expected.format) << word;
+    EXPECT_EQ(inst.dr, expected.dr) << word;
+    EXPECT_EQ(inst.sr1, expected.sr1) << word;
+    EXPECT_EQ(inst.sr2, expected.sr2) << word;
+    EXPECT_EQ(inst.immediate, expected.immediate) << word;
+}
+
+TEST(isa, decode_many_matches_every_halfword) {
+    for (uint32_t word = 0; word <= 0xFFFF; word += 2) {
+        const std::array<uint8_t, 2> bytes{(uint8_t) word, (uint8_t) (word >> 8)};
+        isa::encoded_instruction encoded{.size = isa::instruction_size_type::halfword};
+        encoded.halfword = word;
+        expect_decodes_like_constructor(bytes, encoded);
+    }
+}
+
+TEST(isa, decode_many_matches_fullwords) {
+    std::mt19937 random(7);
+
+    //every opcode and funcode, with random operand bits
+    constexpr uint32_t nfixed = 1u << (isa::opcode_bitsize + isa::longfun_bitsize);
+    for (uint32_t fixed = 0; fixed < nfixed; fixed++) {
+        for (int i = 0; i < 64; i++) {
+            const uint32_t word = (random() & ~0xFFFu) | fixed << isa::opcode_pos | 1;
+            const std::array<uint8_t, 4> bytes{(uint8_t) word, (uint8_t) (word >> 8),
+                                               (uint8_t) (word >> 16), (uint8_t) (word >> 24)};
+            isa::encoded_instruction encoded{.size = isa::instruction_size_type::fullword};
+            encoded.fullword = word;
+            expect_decodes_like_constructor(bytes, encoded);
+        }
+    }
+}
+
+TEST(asm_lang, section_directives) {
+    using asm_lang::section_directive_id;
+
+    for (const auto [name, id]: {std::pair{".text", section_directive_id::text},
+                                 std::pair{".data", section_directive_id::data},
+                                 std::pair{".bss", section_directive_id::bss}}) {
+        const auto *info = asm_lang::string_to_directive_map.find(name);
+        ASSERT_NE(info, nullptr) << name;
+        EXPECT_EQ(info->type, asm_lang::directive_type::section) << name;
+        EXPECT_EQ(info->section_id, id) << name;
+    }
+}
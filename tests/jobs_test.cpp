@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "assemble.h"
+#include "source_buffer.h"
+
+static std::string read_file(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+//global functions calling and branching into each other, every global label starts a partition
+static std::string partitioned_source(int nfunctions) {
+    std::string source = ".data\ncounter: .word 5\n.text\n";
+    for (int f = 0; f < nfunctions; f++) {
+        const auto name = "func" + std::to_string(f);
+        const auto next = "func" + std::to_string((f * 7 + 3) % nfunctions);
+        source += ".global " + name + "\n" + name + ": lw t0, counter\n";
+        for (int i = 0; i < f % 40; i++) source += "    addi t0, t0, " + std::to_string(i) + "\n";
+        source += name + "_loop: addi t1, t1, -1\n"
+                  "    bne t1, zero, " + name + "_loop\n"
+                  "    beq t0, t1, " + next + "\n"
+                  "    jal " + next + "\n"
+                  "    sw t0, counter\n";
+    }
+
+    return source;
+}
+
+//assembles the source with -j 1 and -j 4, the files have to be identical
+static void expect_same_output(std::string_view source) {
+    const auto serial = test_output_path("_j1");
+    const auto parallel = test_output_path("_j4");
+    assemble(source, serial, {"-j", "1"});
+    assemble(source, parallel, {"-j", "4"});
+
+    const auto serial_bytes = read_file(serial);
+    ASSERT_FALSE(serial_bytes.empty());
+    EXPECT_TRUE(serial_bytes == read_file(parallel));
+}
+
+TEST(jobs, corpus_is_assembled_identically) {
+    for (const auto name: {"a.s", "p.s", "g1.s"}) {
+        SCOPED_TRACE(name);
+        const auto path = std::filesystem::path{ASSEMBLER_TEST_CORPUS} / name;
+        const auto source = source_buffer::map_file(path);
+        expect_same_output(source.view());
+    }
+}
+
+TEST(jobs, partitions_are_assembled_identically) {
+    expect_same_output(partitioned_source(500));
+}
+
+TEST(jobs, relaxed_partitions_are_assembled_identically) {
+    //the filler pushes branches between functions out of reach, so relaxation has to widen them
+    auto source = partitioned_source(300);
+    source += ".global filler\nfiller: add t0, t1, t2\n";
+    for (int i = 0; i < 5000; i++) source += "    add t0, t1, t2\n";
+    source += "    beq t0, t1, func0\n";
+    expect_same_output(source);
+}
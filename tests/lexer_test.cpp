@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lexer.h"
+#include "ring_buffer.h"
+#include "source_buffer.h"
+
+using token_type = lexer::token::types;
+
+//everything a backend reports about a token
+struct token_record {
+    token_type id;
+    std::string text;
+    int line;
+    std::string payload;//the resolved id of keywords and labels, spelled out
+
+    bool operator==(const token_record &) const = default;
+};
+
+static std::ostream &operator<<(std::ostream &strm, const token_record &tk) {
+    return strm << magic_enum::enum_name(tk.id) << " '" << tk.text << "' line " << tk.line << " "
+                << tk.payload;
+}
+
+template<class id_t>
+static std::string id_name(const auto &kind, id_t id) {
+    return std::string{magic_enum::enum_name(kind)} + " " + std::string{magic_enum::enum_name(id)};
+}
+
+static std::string payload_of(const lexer::token &tk) {
+    using namespace asm_lang;
+
+    switch (tk.get_type()) {
+        case token_type::mnemonic: {
+            const auto &info = tk.get_mnemonic();
+            switch (info.type) {
+                case inst_statement_type::imm_arith: return id_name(info.type, info.imm_arith);
+                case inst_statement_type::reg_arith: return id_name(info.type, info.reg_arith);
+                case inst_statement_type::unary: return id_name(info.type, info.unary);
+                case inst_statement_type::data: return id_name(info.type, info.data);
+                case inst_statement_type::branch: return id_name(info.type, info.branch);
+                case inst_statement_type::jump: return id_name(info.type, info.jump);
+                case inst_statement_type::set: return id_name(info.type, info.set);
+            }
+            return "bad mnemonic";
+        }
+        case token_type::reg:
+            return std::string{magic_enum::enum_name(tk.get_reg())};
+        case token_type::directive: {
+            const auto *info = tk.get_directive();
+            if (info == nullptr) return "unknown";
+            switch (info->type) {
+                case directive_type::section: return id_name(info->type, info->section_id);
+                case directive_type::data: return id_name(info->type, info->data_id);
+                case directive_type::symbol: return id_name(info->type, info->sym_id);
+            }
+            return "bad directive";
+        }
+        case token_type::label:
+            return std::string{identifiers().view(tk.get_label())};
+        default:
+            return "";
+    }
+}
+
+static std::vector<token_record> lex_all(lexer &lex) {
+    std::vector<token_record> tokens;
+
+    do {
+        const auto &tk = lex.fetch_token();
+        tokens.push_back(
+                {tk.get_type(), std::string{tk.get_text()}, tk.get_line(), payload_of(tk)});
+    } while (tokens.back().id != token_type::eof);
+
+    return tokens;
+}
+
+static std::vector<token_record> lex_all(std::string_view source, lexer_backend backend) {
+    lexer lex(source, backend);
+    return lex_all(lex);
+}
+
+//streams the source through a small ring buffer in writes of chunk_size bytes,
+//like the preprocessor output
+static std::vector<token_record> lex_streamed(std::string_view source, lexer_backend backend,
+                                              std::size_t chunk_size) {
+    ring_buffer ring(64);
+    std::thread writer([&] {
+        for (std::size_t pos = 0; pos < source.size(); pos += chunk_size)
+            if (!ring.write(source.data() + pos, std::min(chunk_size, source.size() - pos))) break;
+        ring.close_write();
+    });
+
+    std::vector<token_record> tokens;
+    {
+        lexer lex(ring, backend);
+        tokens = lex_all(lex);
+    }
+    ring.close_read();
+    writer.join();
+    return tokens;
+}
+
+static std::vector<std::filesystem::path> corpus_files() {
+    std::vector<std::filesystem::path> corpus;
+    for (const auto &entry: std::filesystem::directory_iterator(ASSEMBLER_TEST_CORPUS))
+        if (entry.path().extension() == ".s") corpus.push_back(entry.path());
+    std::ranges::sort(corpus);
+    return corpus;
+}
+
+static void expect_same_tokens(const std::vector<token_record> &expected,
+                               const std::vector<token_record> &tokens, const std::string &what) {
+    const std::size_t ntokens = std::min(expected.size(), tokens.size());
+    for (std::size_t i = 0; i < ntokens; i++)
+        ASSERT_EQ(expected[i], tokens[i]) << what << " token " << i;
+    EXPECT_EQ(expected.size(), tokens.size()) << what;
+}
+
+static std::vector<token_type> token_types(std::string_view source) {
+    std::vector<token_type> types;
+    for (const auto &tk: lex_all(source, lexer_backend::simd)) types.push_back(tk.id);
+    return types;
+}
+
+TEST(lexer, registers_and_labels) {
+    //r[0-31] is r0 to r3, a longer name is a label
+    EXPECT_EQ(token_types("r0 r3 r4 r31 s8 t7 fn7 addix\n"),
+              (std::vector{token_type::reg, token_type::reg, token_type::label, token_type::label,
+                           token_type::label, token_type::reg, token_type::reg, token_type::label,
+                           token_type::newline, token_type::eof}));
+}
+
+TEST(lexer, separators_inside_chars_and_strings) {
+    EXPECT_EQ(token_types(".byte ',', ':' \"a,\\\"b\"\n"),
+              (std::vector{token_type::directive, token_type::ch, token_type::comma, token_type::ch,
+                           token_type::string, token_type::newline, token_type::eof}));
+}
+
+//comments are skipped, the newlines around them are not merged
+TEST(lexer, newline_runs_are_one_token) {
+    const auto tokens = lex_all("add\n\n\n// comment\nsub\n", lexer_backend::simd);
+    ASSERT_EQ(tokens.size(), 6u);
+    EXPECT_EQ(tokens[1], (token_record{token_type::newline, "\n\n\n", 4, ""}));
+    EXPECT_EQ(tokens[2], (token_record{token_type::newline, "\n", 5, ""}));
+    EXPECT_EQ(tokens[3], (token_record{token_type::mnemonic, "sub", 5, "reg_arith Sub"}));
+}
+
+//a streamed source lexes like the whole view, whatever the producer's write sizes. The corpus is
+//repeated past a few simd windows so tokens are cut off at the window end and scanned again
+static void expect_streamed_like_whole(lexer_backend backend) {
+    std::string corpus;
+    for (const auto &path: corpus_files()) corpus += source_buffer::map_file(path).view();
+    ASSERT_FALSE(corpus.empty());
+
+    for (const std::size_t chunk_size: {1, 3, 17}) {
+        //a different start for every chunk size moves the window ends to other tokens
+        std::string source(chunk_size, ' ');
+        while (source.size() < (200 << 10)) source += corpus;
+
+        const auto what = std::string{magic_enum::enum_name(backend)} + " in chunks of " +
+                          std::to_string(chunk_size);
+        expect_same_tokens(lex_all(source, backend), lex_streamed(source, backend, chunk_size),
+                           what);
+    }
+}
+
+TEST(lexer, simd_streamed_source_matches_whole_view) {
+    expect_streamed_like_whole(lexer_backend::simd);
+}
+
+#ifdef ASSEMBLER_FLEX_LEXER
+TEST(lexer, flex_streamed_source_matches_whole_view) {
+    expect_streamed_like_whole(lexer_backend::flex);
+}
+
+//the simd scanner has to produce exactly the token stream of the F.l rules, ids included
+TEST(lexer, backends_agree_on_the_corpus) {
+    const auto corpus = corpus_files();
+    ASSERT_FALSE(corpus.empty());
+
+    for (const auto &path: corpus) {
+        const auto source = source_buffer::map_file(path);
+        expect_same_tokens(lex_all(source.view(), lexer_backend::flex),
+                           lex_all(source.view(), lexer_backend::simd), path.string());
+    }
+}
+#endif
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "preprocessor.h"
+#include "source_buffer.h"
+
+//the block loop that is compiled in, preprocessor_test_avx2 and preprocessor_test_scalar build
+//the other ones
+static bool has_simd_loop() {
+#if defined(__AVX2__)
+    return __builtin_cpu_supports("avx2");
+#else
+    return true;
+#endif
+}
+
+//'#' and '\' at every position of sources around the 16 and 32 byte blocks and their tails
+TEST(preprocessor, needs_preprocessing_at_every_position) {
+    if (!has_simd_loop()) GTEST_SKIP() << "no avx2 on this cpu";
+
+    for (std::size_t size = 0; size <= 3 * 32 + 1; size++) {
+        std::string source(size, 'a');
+        EXPECT_FALSE(needs_preprocessing(source)) << size;
+
+        for (const char pp_char: {'#', '\\'}) {
+            for (std::size_t pos = 0; pos < size; pos++) {
+                source[pos] = pp_char;
+                EXPECT_TRUE(needs_preprocessing(source))
+                        << pp_char << " at " << pos << " of " << size;
+                source[pos] = 'a';
+            }
+        }
+    }
+}
+
+//only the view is searched, not what follows it
+TEST(preprocessor, needs_preprocessing_stops_at_the_end) {
+    if (!has_simd_loop()) GTEST_SKIP() << "no avx2 on this cpu";
+
+    const std::string source = std::string(64, 'a') + "#";
+    for (std::size_t size = 0; size < source.size(); size++)
+        EXPECT_FALSE(needs_preprocessing(std::string_view(source).substr(0, size))) << size;
+}
+
+//copies source into a heap buffer the pipeline can read from
+static source_buffer heap_source(std::string_view source) {
+    char *data = static_cast<char *>(std::malloc(source.size()));
+    std::memcpy(data, source.data(), source.size());
+    return source_buffer::adopt_heap(data, source.size());
+}
+
+static std::string read_all(ring_buffer &ring) {
+    std::string output;
+    char chunk[100];
+    for (std::size_t nread; (nread = ring.read(chunk, sizeof(chunk))) != 0;)
+        output.append(chunk, nread);
+    return output;
+}
+
+//without any macros gpp copies its input, through the ring and into the tee
+TEST(preprocessor, pipeline_passes_plain_source_through) {
+    std::string text;
+    for (int i = 0; text.size() < (3 << 20); i++)
+        text += "label" + std::to_string(i) + ": addi s0, s0, " + std::to_string(i) + "\n";
+    const auto source = heap_source(text);
+
+    char *tee_data = nullptr;
+    std::size_t tee_size = 0;
+    FILE *tee = open_memstream(&tee_data, &tee_size);
+
+    char name[] = "gpp";
+    char *argv[] = {name, nullptr};
+    {
+        preprocessor_pipeline pipeline(argv, source, tee);
+        EXPECT_EQ(read_all(pipeline.output()), text);
+    }
+
+    std::fclose(tee);
+    EXPECT_EQ(std::string_view(tee_data, tee_size), text);
+    std::free(tee_data);
+}
+
+//the lexer can stop before the end, gpp's blocked writes have to be released
+TEST(preprocessor, pipeline_stops_when_the_reader_does) {
+    const auto source = heap_source(std::string(4 << 20, ' '));
+
+    char name[] = "gpp";
+    char *argv[] = {name, nullptr};
+    preprocessor_pipeline pipeline(argv, source);
+
+    char first[16];
+    EXPECT_NE(pipeline.output().read(first, sizeof(first)), 0u);
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "assemble.h"
+
+//ids of the instructions in .text, in address order
+static std::vector<isa::inst_id> text_inst_ids(std::string_view source) {
+    const auto output = test_output_path();
+    assemble(source, output);
+
+    std::vector<isa::inst_id> ids;
+    for (const auto &located: text_instructions(output)) ids.push_back(located.inst.id);
+    return ids;
+}
+
+//every immediate arithmetic statement keeps its operation when the immediate needs a fullword
+TEST(semantic, fullword_immediate_arithmetic) {
+    const std::pair<std::string_view, isa::inst_id> statements[] = {
+            {"andi", isa::inst_id::Andi},     {"xori", isa::inst_id::Xori},
+            {"ori", isa::inst_id::Ori},       {"addi", isa::inst_id::Addi},
+            {"multi", isa::inst_id::Multi},   {"divi", isa::inst_id::Divi},
+            {"multui", isa::inst_id::Multui}, {"divui", isa::inst_id::Divui},
+    };
+
+    for (const auto &[mnemonic, id]: statements) {
+        const auto ids = text_inst_ids(".text\n" + std::string{mnemonic} + " s0, s1, 300\n");
+        EXPECT_TRUE(std::ranges::find(ids, id) != ids.end()) << mnemonic;
+    }
+}
+
+//a branch over filler instructions of nbytes in total, to the label after them
+static std::string branch_over(int nbytes) {
+    std::string source = ".text\nbeq t0, t1, target\n";
+    for (int i = 0; i < nbytes / 4; i++) source += "add t0, t1, t2\n";
+    return source + "target: add t0, t1, t2\n";
+}
+
+//the lower and upper immediate fields together hold 14 bits of a halfword offset,
+//the furthest forward branch is 2^14 - 2 bytes
+TEST(semantic, short_branch_reach) {
+    const auto output = test_output_path();
+    assemble(branch_over(16376), output);
+
+    const auto instructions = text_instructions(output);
+    ASSERT_GE(instructions.size(), 2u);
+    EXPECT_EQ(instructions[0].inst.id, isa::inst_id::Beq);
+    EXPECT_EQ(instructions[0].inst.immediate, 16380);
+    EXPECT_EQ(instructions[1].inst.id, isa::inst_id::Add);
+}
+
+//out of reach the reversed branch skips the jump that follows it
+TEST(semantic, long_branch) {
+    const auto output = test_output_path();
+    assemble(branch_over(16380), output);
+
+    const auto instructions = text_instructions(output);
+    ASSERT_GE(instructions.size(), 2u);
+    EXPECT_EQ(instructions[0].inst.id, isa::inst_id::Bne);
+    EXPECT_EQ(instructions[0].inst.immediate, 8);
+    EXPECT_EQ(instructions[1].inst.id, isa::inst_id::Rji);
+    EXPECT_EQ(instructions[1].address + instructions[1].inst.immediate, 8u + 16380u);
+}
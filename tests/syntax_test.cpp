@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "syntax.h"
+
+//parses a single statement, returns the value of its last argument
+static int64_t last_integer(const std::string &source) {
+    syntax parser(source, lexer_backend::simd);
+    const auto [stmnt, eof] = parser.parse_statement();
+    return stmnt.args.back().int_val;
+}
+
+TEST(syntax, integer_limits) {
+    EXPECT_EQ(last_integer("addi s0, s0, 9223372036854775807\n"),
+              std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(last_integer("addi s0, s0, -9223372036854775808\n"),
+              std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(last_integer("addi s0, s0, 0x7fffffffffffffff\n"),
+              std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(last_integer("addi s0, s0, -1\n"), -1);
+}
+
+TEST(syntax, integer_overflow_is_an_error) {
+    EXPECT_THROW(last_integer("addi s0, s0, 9223372036854775808\n"), std::runtime_error);
+    EXPECT_THROW(last_integer("addi s0, s0, -9223372036854775809\n"), std::runtime_error);
+    EXPECT_THROW(last_integer("addi s0, s0, 0xffffffffffffffff\n"), std::runtime_error);
+    EXPECT_THROW(last_integer("addi s0, s0, 18446744073709551616\n"), std::runtime_error);
+    EXPECT_THROW(last_integer(".word 0x10000000000000000\n"), std::runtime_error);
+}
+
+TEST(syntax, binary_literals) {
+    EXPECT_EQ(last_integer("addi s0, s0, 0b101\n"), 5);
+    EXPECT_EQ(last_integer("addi s0, s0, -0b11\n"), -3);
+    EXPECT_EQ(last_integer(".word 0b11111111\n"), 255);
+}